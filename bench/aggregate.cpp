@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+#include "field_reflection/aggregate.hpp"
+
+using namespace field_reflection;
+
+namespace
+{
+    struct tick
+    {
+        std::uint64_t timestamp;
+        double bid;
+        double ask;
+        std::uint32_t bid_size;
+        std::uint32_t ask_size;
+        std::int32_t venue;
+        float spread;
+    };
+
+    const std::vector<tick>& ticks()
+    {
+        static const auto rows = []() {
+            auto rng = std::mt19937_64(42);
+            auto price = std::uniform_real_distribution<double>(99.0, 101.0);
+            auto result = std::vector<tick>(std::size_t{1} << 24);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                const auto bid = price(rng);
+                result[i] = {i, bid, bid + 0.01, static_cast<std::uint32_t>(rng() % 1000),
+                             static_cast<std::uint32_t>(rng() % 1000), static_cast<std::int32_t>(rng() % 16), 0.01f};
+            }
+            return result;
+        }();
+        return rows;
+    }
+
+    void aggregate_threads(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks());
+        for (auto _ : state)
+        {
+            auto result = aggregate_fields(rows, summary_reducer{}, static_cast<std::size_t>(state.range(0)));
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rows.size()));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(rows.size_bytes()));
+    }
+}  // namespace
+
+BENCHMARK(aggregate_threads)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
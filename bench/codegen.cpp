@@ -0,0 +1,138 @@
+// Pairs of functions compared by codegen_check.py: every library_<name> must compile to no more instructions and no
+// more stack accesses than the hand-written manual_<name>.
+#include <cstdint>
+#include "field_reflection.hpp"
+
+using namespace field_reflection;
+
+struct point
+{
+    std::int32_t x;
+    std::int32_t y;
+    std::int32_t z;
+};
+
+struct record
+{
+    std::uint64_t id;
+    double price;
+    std::int32_t quantity;
+    std::uint16_t flags;
+    std::uint8_t kind;
+    bool active;
+    double tax;
+    std::uint64_t timestamp;
+};
+
+// NOLINTBEGIN
+extern "C"
+{
+    // for_each_field
+    std::int64_t manual_sum(const point& p) { return std::int64_t{p.x} + p.y + p.z; }
+    std::int64_t library_sum(const point& p)
+    {
+        auto sum = std::int64_t{0};
+        for_each_field(p, [&](auto field) { sum += field; });
+        return sum;
+    }
+
+    double manual_record_sum(const record& r)
+    {
+        auto sum = 0.0;
+        sum += static_cast<double>(r.id);
+        sum += r.price;
+        sum += r.quantity;
+        sum += r.flags;
+        sum += r.kind;
+        sum += r.active;
+        sum += r.tax;
+        sum += static_cast<double>(r.timestamp);
+        return sum;
+    }
+    double library_record_sum(const record& r)
+    {
+        auto sum = 0.0;
+        for_each_field(r, [&](auto field) { sum += static_cast<double>(field); });
+        return sum;
+    }
+
+    void manual_scale(point& p, std::int32_t k)
+    {
+        p.x *= k;
+        p.y *= k;
+        p.z *= k;
+    }
+    void library_scale(point& p, std::int32_t k)
+    {
+        for_each_field(p, [&](auto& field) { field *= k; });
+    }
+
+    std::size_t manual_name_length(const point&) { return 3; }
+    std::size_t library_name_length(const point& p)
+    {
+        auto length = std::size_t{0};
+        for_each_field(p, [&](std::string_view name, auto) { length += name.size(); });
+        return length;
+    }
+
+    // field_names
+    const char* manual_names(std::size_t i)
+    {
+        static constexpr std::string_view names[] = {"id",   "price",  "quantity", "flags",
+                                                     "kind", "active", "tax",      "timestamp"};
+        return names[i].data();
+    }
+    const char* library_names(std::size_t i) { return field_names<record>[i].data(); }
+
+    // binary for_each_field and all_of_field
+    void manual_copy(point& dst, const point& src)
+    {
+        dst.x = src.x;
+        dst.y = src.y;
+        dst.z = src.z;
+    }
+    void library_copy(point& dst, const point& src)
+    {
+        for_each_field(dst, src, [](auto& d, const auto& s) { d = s; });
+    }
+
+    bool manual_all_positive(const point& p) { return p.x > 0 && p.y > 0 && p.z > 0; }
+    bool library_all_positive(const point& p)
+    {
+        return all_of_field(p, [](auto field) { return field > 0; });
+    }
+
+    bool manual_any_zero(const record& r) { return r.quantity == 0 || r.flags == 0 || r.kind == 0; }
+    bool library_any_zero(const record& r)
+    {
+        return any_of_field(r, [](auto field) {
+            if constexpr (std::is_integral_v<decltype(field)> && !std::is_same_v<decltype(field), bool> &&
+                          sizeof(field) < 8)
+                return field == 0;
+            else
+                return false;
+        });
+    }
+
+    // get_field
+    double manual_get(const record& r) { return r.price * r.quantity; }
+    double library_get(const record& r) { return get_field<1>(r) * get_field<2>(r); }
+
+    void manual_set(record& r, double tax) { r.tax = tax; }
+    void library_set(record& r, double tax) { get_field<6>(r) = tax; }
+
+    // to_tuple
+    std::int64_t manual_tuple(const point& p) { return std::int64_t{p.x} * p.z; }
+    std::int64_t library_tuple(const point& p)
+    {
+        auto t = to_tuple(p);
+        return std::int64_t{std::get<0>(t)} * std::get<2>(t);
+    }
+
+    std::int64_t manual_apply(const point& p) { return std::int64_t{p.x} - p.y + p.z; }
+    std::int64_t library_apply(const point& p)
+    {
+        return std::apply([](auto x, auto y, auto z) { return std::int64_t{x} - y + z; }, to_tuple(p));
+    }
+}
+// NOLINTEND
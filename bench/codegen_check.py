@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Code generation check of field-reflection.
+
+Compiles codegen.cpp to assembly with the given compiler and optimization levels, and compares every function
+library_<name> with its hand-written counterpart manual_<name>. The check fails if the library version has more
+instructions or more stack accesses (push/pop or memory operands relative to the stack or frame pointer) than the
+manual version, unless the function is listed in KNOWN_DIFFERENCES, in which case the difference is reported but
+does not fail the check. It also fails if a function signature from which field names are parsed is emitted as a
+string. GCC and Clang are supported.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+STACK_ACCESS = re.compile(r"^(push|pop)|\[(rsp|rbp|esp|ebp|sp|x29)\b|\((%rsp|%rbp|%esp|%ebp)\)|\b(sp|x29),")
+LABEL = re.compile(r"^([A-Za-z_.$][\w.$]*):")
+STRING = re.compile(r'^\.(string|ascii|asciz)\s+"(.*)"')
+
+# differences from the manual code that the library cannot avoid, keyed by function name
+KNOWN_DIFFERENCES = {
+    "copy": "the callback receives the fields as plain references, through which GCC does not merge adjacent loads "
+    "and stores as it does for direct member access",
+}
+
+
+def compile_to_assembly(compiler, include_dir, source, opt, flags):
+    command = [compiler, "-std=c++20", f"-{opt}", "-S", "-o", "-", "-fno-asynchronous-unwind-tables", "-fno-exceptions"]
+    command += ["-masm=intel"] if is_x86(compiler) else []
+    command += [f"-I{include_dir}", *flags, source]
+    completed = subprocess.run(command, capture_output=True, text=True)
+    if completed.returncode != 0:
+        sys.stderr.write(completed.stderr)
+        raise RuntimeError(f"compilation failed: {' '.join(command)}")
+    return completed.stdout
+
+
+def is_x86(compiler):
+    machine = subprocess.run([compiler, "-dumpmachine"], capture_output=True, text=True).stdout
+    return machine.startswith(("x86_64", "i386", "i486", "i586", "i686"))
+
+
+def split_functions(assembly):
+    """Returns the instructions of each function keyed by its symbol name."""
+    functions = {}
+    current = None
+    for line in assembly.splitlines():
+        stripped = line.strip()
+        if not stripped or stripped.startswith(("#", "//", ";")):
+            continue
+        label = LABEL.match(stripped)
+        if label:
+            name = label.group(1)
+            if name.startswith(("manual_", "library_")):
+                current = functions.setdefault(name, [])
+            continue
+        if stripped.startswith("."):
+            if stripped.startswith(".size"):
+                current = None
+            continue
+        if current is not None:
+            current.append(stripped)
+    return functions
+
+
+def signature_strings(assembly):
+    """Returns the string literals containing the signature of the function used to obtain field names."""
+    strings = (STRING.match(line.strip()) for line in assembly.splitlines())
+    return [m.group(2) for m in strings if m and "get_function_name" in m.group(2)]
+
+
+def stack_accesses(instructions):
+    return sum(1 for i in instructions if STACK_ACCESS.search(i))
+
+
+def check(compiler, include_dir, source, opt, flags, verbose):
+    assembly = compile_to_assembly(compiler, include_dir, source, opt, flags)
+    functions = split_functions(assembly)
+    names = sorted(name[len("library_") :] for name in functions if name.startswith("library_"))
+    if not names:
+        raise RuntimeError("no library_* function found in the assembly")
+    failed = []
+    print(f"{os.path.basename(compiler)} -{opt}")
+    print(f"{'function':<24}{'manual':>8}{'library':>9}{'stack (m/l)':>14}")
+    for name in names:
+        manual = functions.get(f"manual_{name}")
+        library = functions[f"library_{name}"]
+        if manual is None:
+            raise RuntimeError(f"manual_{name} not found")
+        ms, ls = stack_accesses(manual), stack_accesses(library)
+        ok = len(library) <= len(manual) and ls <= ms
+        status = "ok" if ok else "known" if name in KNOWN_DIFFERENCES else "FAILED"
+        print(f"{name:<24}{len(manual):>8}{len(library):>9}{f'{ms}/{ls}':>14}  {status}")
+        if not ok:
+            if name in KNOWN_DIFFERENCES:
+                print(f"  {KNOWN_DIFFERENCES[name]}")
+            else:
+                failed.append(name)
+            if verbose:
+                print("  manual:\n    " + "\n    ".join(manual))
+                print("  library:\n    " + "\n    ".join(library))
+    for string in signature_strings(assembly):
+        print(f"function signature emitted: {string}")
+        failed.append("signature strings")
+    print()
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", required=True, help="directory containing field_reflection.hpp")
+    parser.add_argument(
+        "--source", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "codegen.cpp")
+    )
+    parser.add_argument("--opt", action="append", help="optimization level, e.g. O2 (repeatable, default: O2 and O3)")
+    parser.add_argument("--verbose", action="store_true", help="print the assembly of the failed functions")
+    parser.add_argument("--flags", nargs=argparse.REMAINDER, default=[], help="extra compiler flags")
+    args = parser.parse_args()
+
+    failed = []
+    for opt in args.opt or ["O2", "O3"]:
+        failed += [f"{name} (-{opt})" for name in check(args.compiler, args.include, args.source, opt, args.flags,
+                                                           args.verbose)]
+    if failed:
+        print(f"codegen check failed: {', '.join(failed)}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
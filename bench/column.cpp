@@ -0,0 +1,147 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "field_reflection/column.hpp"
+
+using namespace field_reflection;
+
+namespace
+{
+    struct tick
+    {
+        std::uint64_t timestamp;
+        double bid;
+        double ask;
+        std::uint32_t bid_size;
+        std::uint32_t ask_size;
+        std::int32_t venue;
+        float spread;
+    };
+
+    const std::vector<tick>& ticks()
+    {
+        static const auto rows = []() {
+            auto rng = std::mt19937_64(42);
+            auto price = std::uniform_real_distribution<double>(99.0, 101.0);
+            auto result = std::vector<tick>(std::size_t{1} << 20);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                const auto bid = price(rng);
+                result[i] = {i, bid, bid + 0.01, static_cast<std::uint32_t>(rng() % 1000),
+                             static_cast<std::uint32_t>(rng() % 1000), static_cast<std::int32_t>(rng() % 16),
+                             static_cast<float>(rng() % 100) * 0.01f};
+            }
+            return result;
+        }();
+        return rows;
+    }
+
+    void set_processed(benchmark::State& state, std::span<const tick> rows)
+    {
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rows.size()));
+    }
+
+    void projection_sum_bid(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto sum = 0.0;
+            for (auto bid : rows | std::views::transform(&tick::bid)) sum += bid;
+            benchmark::DoNotOptimize(sum);
+        }
+        set_processed(state, rows);
+    }
+
+    void column_sum_bid(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto sum = reduce_field<1>(rows);
+            benchmark::DoNotOptimize(sum);
+        }
+        set_processed(state, rows);
+    }
+
+    void projection_sum_venue(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto sum = std::int32_t{0};
+            for (auto venue : rows | std::views::transform(&tick::venue)) sum += venue;
+            benchmark::DoNotOptimize(sum);
+        }
+        set_processed(state, rows);
+    }
+
+    void column_sum_venue(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto sum = reduce_field<5>(rows);
+            benchmark::DoNotOptimize(sum);
+        }
+        set_processed(state, rows);
+    }
+
+    void projection_min_spread(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto min = std::ranges::min(rows | std::views::transform(&tick::spread));
+            benchmark::DoNotOptimize(min);
+        }
+        set_processed(state, rows);
+    }
+
+    void column_min_spread(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto min = min_field<6>(rows);
+            benchmark::DoNotOptimize(min);
+        }
+        set_processed(state, rows);
+    }
+
+    void projection_count_ask(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto count = std::ranges::count_if(rows | std::views::transform(&tick::ask),
+                                               [](double ask) { return ask > 100.0; });
+            benchmark::DoNotOptimize(count);
+        }
+        set_processed(state, rows);
+    }
+
+    void column_count_ask(benchmark::State& state)
+    {
+        const auto rows = std::span(ticks()).first(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto count = count_if_field<2>(rows, [](double ask) { return ask > 100.0; });
+            benchmark::DoNotOptimize(count);
+        }
+        set_processed(state, rows);
+    }
+}  // namespace
+
+BENCHMARK(projection_sum_bid)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(column_sum_bid)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(projection_sum_venue)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(column_sum_venue)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(projection_min_spread)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(column_min_spread)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(projection_count_ask)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(column_count_ask)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+"""Compile-time benchmark of field-reflection.
+
+Generates translation units with synthetic aggregates of a given number of fields of mixed member types, compiles each
+of them with the given compilers under each API and reports the wall time and the peak memory of the compiler process.
+The cost of the header itself is measured with a translation unit without any use of the API and subtracted to obtain
+the instantiation cost. The preprocessing and parsing cost of the header is also reported for several values of
+FIELD_RFL_MAX_FIELDS. With --time-trace, the breakdown of the compilation is recorded from -ftime-trace (Clang) or
+-ftime-report (GCC). The JSON report can be compared with a previous one by --baseline.
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+APIS = ["field_count", "field_name", "field_type", "to_tuple", "for_each_field"]
+
+MEMBER_TYPES = [
+    "int",
+    "double",
+    "std::string",
+    "char",
+    "std::uint64_t",
+    "float",
+    "bool",
+    "void*",
+    "short",
+    "std::array<int, 2>",
+]
+
+
+def generate_source(api, fields, types):
+    lines = ['#include <array>', '#include <cstdint>', '#include <string>', '#include "field_reflection.hpp"', ""]
+    for t in range(types):
+        members = " ".join(f"{MEMBER_TYPES[(i + t) % len(MEMBER_TYPES)]} f{i};" for i in range(fields))
+        lines.append(f"struct s{t} {{ {members} }};")
+    lines.append("")
+    for t in range(types):
+        if api == "header":
+            pass
+        elif api == "field_count":
+            lines.append(f"static_assert(field_reflection::field_count<s{t}> == {fields});")
+        elif api == "field_name":
+            for i in range(fields):
+                lines.append(f'static_assert(field_reflection::field_name<s{t}, {i}> == "f{i}");')
+        elif api == "field_type":
+            for i in range(fields):
+                member = MEMBER_TYPES[(i + t) % len(MEMBER_TYPES)]
+                lines.append(f"static_assert(std::is_same_v<field_reflection::field_type<s{t}, {i}>, {member}>);")
+        elif api == "to_tuple":
+            lines.append(f"auto use{t}(s{t}& v) {{ return field_reflection::to_tuple(v); }}")
+        elif api == "for_each_field":
+            lines.append(
+                f"void use{t}(s{t}& v) {{ field_reflection::for_each_field(v, [](std::string_view n, auto& f) "
+                f"{{ static_cast<void>(n); static_cast<void>(f); }}); }}"
+            )
+        else:
+            raise ValueError(f"unknown api: {api}")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def is_msvc_like(compiler):
+    return os.path.splitext(os.path.basename(compiler))[0].lower() in ("cl", "clang-cl")
+
+
+def is_clang(compiler):
+    try:
+        version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+    except OSError:
+        return False
+    return "clang" in version.lower()
+
+
+def compiler_version(compiler):
+    command = [compiler] if is_msvc_like(compiler) else [compiler, "--version"]
+    completed = subprocess.run(command, capture_output=True, text=True)
+    lines = (completed.stdout or completed.stderr).strip().splitlines()
+    return lines[0] if lines else ""
+
+
+def compile_command(compiler, include_dir, source, extra_flags, preprocess_only=False):
+    if is_msvc_like(compiler):
+        mode = ["/EP"] if preprocess_only else ["/Zs"]
+        return [compiler, "/nologo", "/std:c++20", "/Zc:preprocessor", *mode, f"/I{include_dir}", *extra_flags, source]
+    mode = ["-E", "-o", os.devnull] if preprocess_only else ["-fsyntax-only"]
+    return [compiler, "-std=c++20", *mode, f"-I{include_dir}", *extra_flags, source]
+
+
+def define_flag(compiler, name, value):
+    return f"/D{name}={value}" if is_msvc_like(compiler) else f"-D{name}={value}"
+
+
+def run_compiler(command):
+    """Returns the wall time in seconds, the peak RSS in KiB (None if unavailable) and the diagnostic output."""
+    start = time.perf_counter()
+    if hasattr(os, "wait4"):
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        output = process.stderr.read()
+        _, status, usage = os.wait4(process.pid, 0)
+        elapsed = time.perf_counter() - start
+        returncode = os.waitstatus_to_exitcode(status)
+        peak = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    else:
+        completed = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        elapsed = time.perf_counter() - start
+        output, returncode, peak = completed.stderr, completed.returncode, None
+    if returncode != 0:
+        sys.stderr.write(output.decode(errors="replace"))
+        raise RuntimeError(f"compilation failed: {' '.join(command)}")
+    return elapsed, peak, output.decode(errors="replace")
+
+
+def write_source(args, api, fields, workdir):
+    source = os.path.join(workdir, f"{api}_{fields}.cpp")
+    with open(source, "w", encoding="utf-8") as f:
+        f.write(generate_source(api, fields, args.types))
+    return source
+
+
+def measure(args, compiler, api, fields, workdir, flags=(), preprocess_only=False):
+    source = write_source(args, api, fields, workdir)
+    command = compile_command(compiler, args.include, source, [*args.flags, *flags], preprocess_only)
+    results = [run_compiler(command) for _ in range(args.repeat)]
+    peaks = [p for _, p, _ in results if p is not None]
+    return min(t for t, _, _ in results), (min(peaks) if peaks else None)
+
+
+TIME_REPORT_LINE = re.compile(r"^\s*\|?\s*(.+?)\s*:\s*([\d.]+)\s*(?:\(\s*\d+%\))?\s*([\d.]+)\s*(?:\(\s*\d+%\))?\s*([\d.]+)")
+
+
+def trace(args, compiler, api, fields, workdir, trace_dir):
+    """Returns the breakdown of the compilation time in seconds, or None if not supported by the compiler."""
+    source = write_source(args, api, fields, workdir)
+    if is_msvc_like(compiler):
+        return None
+    if is_clang(compiler):
+        trace_file = os.path.join(workdir, f"{api}_{fields}.json")
+        command = compile_command(compiler, args.include, source, [*args.flags, f"-ftime-trace={trace_file}"])
+        run_compiler(command)
+        with open(trace_file, encoding="utf-8") as f:
+            events = json.load(f)["traceEvents"]
+        if trace_dir:
+            shutil.copy(trace_file, os.path.join(trace_dir, f"{os.path.basename(compiler)}_{api}_{fields}.json"))
+        # the "Total ..." events summarize the time spent in each kind of activity
+        return {
+            e["name"][len("Total ") :]: e["dur"] / 1e6
+            for e in events
+            if e.get("name", "").startswith("Total ") and "dur" in e
+        }
+    command = compile_command(compiler, args.include, source, [*args.flags, "-ftime-report"])
+    _, _, output = run_compiler(command)
+    if trace_dir:
+        with open(
+            os.path.join(trace_dir, f"{os.path.basename(compiler)}_{api}_{fields}.txt"), "w", encoding="utf-8"
+        ) as f:
+            f.write(output)
+    breakdown = {}
+    for line in output.splitlines():
+        match = TIME_REPORT_LINE.match(line)
+        if match and match.group(1) != "TOTAL":
+            breakdown[match.group(1)] = float(match.group(4))  # wall time
+    return breakdown
+
+
+def parse_fields(text):
+    values = []
+    for part in text.split(","):
+        if "-" in part:
+            first, last, *step = part.split("-")
+            values.extend(range(int(first), int(last) + 1, int(step[0]) if step else 1))
+        else:
+            values.append(int(part))
+    return values
+
+
+def run(args, compiler, apis):
+    report = {
+        "compiler": compiler,
+        "version": compiler_version(compiler),
+        "types_per_tu": args.types,
+        "header_limits": [],
+        "results": [],
+    }
+    print(f"{report['version']}")
+    with tempfile.TemporaryDirectory() as workdir:
+        print(f"{'limit':<16}{'pp [s]':>12}{'parse [s]':>12}{'peak [MiB]':>12}")
+        for limit in parse_fields(args.limits):
+            flags = [define_flag(compiler, "FIELD_RFL_MAX_FIELDS", limit)]
+            pp_time, _ = measure(args, compiler, "header", 0, workdir, flags, preprocess_only=True)
+            parse_time, peak = measure(args, compiler, "header", 0, workdir, flags)
+            report["header_limits"].append(
+                {"limit": limit, "preprocess_s": pp_time, "parse_s": parse_time, "peak_rss_kib": peak}
+            )
+            print(f"{limit:<16}{pp_time:>12.3f}{parse_time:>12.3f}{(peak or 0) / 1024:>12.1f}", flush=True)
+        print()
+
+        print(f"{'api':<16}{'fields':>8}{'time [s]':>12}{'inst. [s]':>12}{'peak [MiB]':>12}")
+        for fields in parse_fields(args.fields):
+            # the struct definitions are included in the baseline so that only the use of the API is measured
+            base_time, base_peak = measure(args, compiler, "header", fields, workdir)
+            report["results"].append(
+                {"api": "header", "fields": fields, "time_s": base_time, "peak_rss_kib": base_peak}
+            )
+            print(f"{'(header)':<16}{fields:>8}{base_time:>12.3f}{'-':>12}{(base_peak or 0) / 1024:>12.1f}")
+            for api in apis:
+                elapsed, peak = measure(args, compiler, api, fields, workdir)
+                result = {
+                    "api": api,
+                    "fields": fields,
+                    "time_s": elapsed,
+                    "instantiation_s": max(0.0, elapsed - base_time),
+                    "peak_rss_kib": peak,
+                }
+                if args.time_trace:
+                    result["trace_s"] = trace(args, compiler, api, fields, workdir, args.trace_dir)
+                report["results"].append(result)
+                print(
+                    f"{api:<16}{fields:>8}{elapsed:>12.3f}{max(0.0, elapsed - base_time):>12.3f}"
+                    f"{(peak or 0) / 1024:>12.1f}",
+                    flush=True,
+                )
+        print()
+    return report
+
+
+def compare(reports, baseline):
+    """Prints the change of the compile time from the baseline report for the same compiler, API and field count."""
+    old = {
+        (r["compiler"], x["api"], x["fields"]): x["time_s"] for r in baseline["compilers"] for x in r["results"]
+    }
+    print(f"{'compiler':<16}{'api':<16}{'fields':>8}{'old [s]':>12}{'new [s]':>12}{'change':>10}")
+    for report in reports:
+        for x in report["results"]:
+            key = (report["compiler"], x["api"], x["fields"])
+            if key in old and old[key] > 0:
+                name = os.path.basename(report["compiler"])
+                change = (x["time_s"] / old[key] - 1.0) * 100.0
+                print(f"{name:<16}{x['api']:<16}{x['fields']:>8}{old[key]:>12.3f}{x['time_s']:>12.3f}{change:>+9.1f}%")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--compiler", action="append", help="compiler to benchmark (repeatable, default: $CXX or c++)"
+    )
+    parser.add_argument("--include", required=True, help="directory containing field_reflection.hpp")
+    parser.add_argument("--api", action="append", choices=APIS, help="API to benchmark (repeatable, default: all)")
+    parser.add_argument("--fields", default="1,10-100-10", help="field counts, e.g. '1,10-100-10'")
+    parser.add_argument("--types", type=int, default=10, help="number of distinct structs per translation unit")
+    parser.add_argument("--limits", default="100,256,512", help="values of FIELD_RFL_MAX_FIELDS for the header cost")
+    parser.add_argument("--repeat", type=int, default=3, help="number of compilations per data point (min is taken)")
+    parser.add_argument(
+        "--time-trace", action="store_true", help="record the breakdown by -ftime-trace (Clang) or -ftime-report (GCC)"
+    )
+    parser.add_argument("--trace-dir", help="keep the raw time trace files in this directory")
+    parser.add_argument("--baseline", help="compare with a previous report written by --output")
+    parser.add_argument("--flags", nargs=argparse.REMAINDER, default=[], help="extra compiler flags")
+    parser.add_argument("--output", help="write the report as JSON to this file")
+    args = parser.parse_args()
+    compilers = args.compiler or [os.environ.get("CXX", "c++")]
+    apis = args.api or APIS
+    if args.trace_dir:
+        os.makedirs(args.trace_dir, exist_ok=True)
+
+    reports = [run(args, compiler, apis) for compiler in compilers]
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            json.dump({"compilers": reports}, f, indent=2, sort_keys=True)
+    if args.baseline:
+        with open(args.baseline, encoding="utf-8") as f:
+            compare(reports, json.load(f))
+
+
+if __name__ == "__main__":
+    main()
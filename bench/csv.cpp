@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "field_reflection/csv.hpp"
+
+using namespace field_reflection;
+
+namespace
+{
+    struct tick
+    {
+        std::uint64_t timestamp;
+        std::string symbol;
+        double bid;
+        double ask;
+        std::uint32_t bid_size;
+        std::uint32_t ask_size;
+        std::int32_t venue;
+    };
+
+    const std::string& input()
+    {
+        static const auto text = []() {
+            auto rng = std::mt19937_64(42);
+            auto price = std::uniform_real_distribution<double>(99.0, 101.0);
+            auto result = std::string("timestamp,symbol,bid,ask,bid_size,ask_size,venue\n");
+            for (std::size_t i = 0; i < (std::size_t{1} << 20); ++i)
+            {
+                const auto bid = price(rng);
+                result += std::to_string(1700000000000000000 + i) + ",SYM" + std::to_string(rng() % 500) + "," +
+                          std::to_string(bid) + "," + std::to_string(bid + 0.01) + "," + std::to_string(rng() % 1000) +
+                          "," + std::to_string(rng() % 1000) + "," + std::to_string(rng() % 16) + "\n";
+            }
+            return result;
+        }();
+        return text;
+    }
+
+    void set_processed(benchmark::State& state)
+    {
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(input().size()));
+    }
+
+    void getline_stringstream(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            auto rows = std::vector<tick>{};
+            auto in = std::istringstream(input());
+            auto line = std::string{};
+            std::getline(in, line);
+            while (std::getline(in, line))
+            {
+                auto fields = std::istringstream(line);
+                auto row = tick{};
+                auto value = std::string{};
+                std::getline(fields, value, ',');
+                row.timestamp = std::stoull(value);
+                std::getline(fields, row.symbol, ',');
+                std::getline(fields, value, ',');
+                row.bid = std::stod(value);
+                std::getline(fields, value, ',');
+                row.ask = std::stod(value);
+                std::getline(fields, value, ',');
+                row.bid_size = static_cast<std::uint32_t>(std::stoul(value));
+                std::getline(fields, value, ',');
+                row.ask_size = static_cast<std::uint32_t>(std::stoul(value));
+                std::getline(fields, value, ',');
+                row.venue = std::stoi(value);
+                rows.push_back(std::move(row));
+            }
+            benchmark::DoNotOptimize(rows);
+        }
+        set_processed(state);
+    }
+
+    void load_csv_threads(benchmark::State& state)
+    {
+        const auto& text = input();
+        for (auto _ : state)
+        {
+            auto rows = load_csv<tick>(std::span(text.data(), text.size()),
+                                       {.threads = static_cast<std::size_t>(state.range(0))});
+            benchmark::DoNotOptimize(rows);
+        }
+        set_processed(state);
+    }
+}  // namespace
+
+BENCHMARK(getline_stringstream)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(load_csv_threads)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,164 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "field_reflection.hpp"
+
+using namespace field_reflection;
+
+namespace
+{
+    std::int64_t allocations = 0;
+    std::int64_t moves = 0;
+    std::int64_t copies = 0;
+}  // namespace
+
+// NOLINTBEGIN
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (auto* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+// NOLINTEND
+
+namespace
+{
+    // a buffer that counts its moves and copies
+    struct buffer
+    {
+        std::vector<double> data;
+
+        explicit buffer(std::size_t n) : data(n) {}
+        buffer(const buffer& other) : data(other.data) { ++copies; }
+        buffer(buffer&& other) noexcept : data(std::move(other.data)) { ++moves; }
+        buffer& operator=(const buffer&) = default;
+        buffer& operator=(buffer&&) = default;
+        ~buffer() = default;
+    };
+
+    // the user-declared destructor suppresses the move constructor, so it is copied even from an rvalue
+    struct legacy_buffer
+    {
+        std::vector<char> data = std::vector<char>(256);
+        ~legacy_buffer() {}  // NOLINT(modernize-use-equals-default)
+    };
+
+    struct message
+    {
+        std::uint64_t id;
+        std::string topic;
+        buffer header;
+        buffer payload;
+        buffer trailer;
+        legacy_buffer legacy;
+    };
+
+    message make_message() { return {42, "topic", buffer(16), buffer(1024), buffer(16), {}}; }
+
+    template <typename Extract>
+    void run(benchmark::State& state, Extract extract)
+    {
+        auto total_moves = std::int64_t{0};
+        auto total_copies = std::int64_t{0};
+        auto total_allocations = std::int64_t{0};
+        for (auto _ : state)
+        {
+            auto m = make_message();
+            const auto moves0 = moves;
+            const auto copies0 = copies;
+            const auto allocations0 = allocations;
+            auto payload = extract(std::move(m));
+            total_moves += moves - moves0;
+            total_copies += copies - copies0;
+            total_allocations += allocations - allocations0;
+            benchmark::DoNotOptimize(payload);
+        }
+        state.counters["moves"] =
+            benchmark::Counter(static_cast<double>(total_moves), benchmark::Counter::kAvgIterations);
+        state.counters["copies"] =
+            benchmark::Counter(static_cast<double>(total_copies), benchmark::Counter::kAvgIterations);
+        state.counters["allocs"] =
+            benchmark::Counter(static_cast<double>(total_allocations), benchmark::Counter::kAvgIterations);
+    }
+
+    void manual_extract(benchmark::State& state)
+    {
+        run(state, [](message&& m) { return std::move(m.payload); });
+    }
+
+    void get_field_extract(benchmark::State& state)
+    {
+        run(state, [](message&& m) { return get_field<3>(std::move(m)); });
+    }
+
+    // extraction through a moved tuple of all fields
+    void to_tuple_extract(benchmark::State& state)
+    {
+        run(state, [](message&& m) { return std::get<3>(to_tuple(std::move(m))); });
+    }
+
+    // visits of an rvalue that take the buffers and read the other fields
+    void manual_visit(benchmark::State& state)
+    {
+        run(state, [](message&& m) {
+            auto buffers = std::vector<buffer>();
+            buffers.reserve(3);
+            benchmark::DoNotOptimize(m.id);
+            benchmark::DoNotOptimize(m.topic);
+            buffers.push_back(std::move(m.header));
+            buffers.push_back(std::move(m.payload));
+            buffers.push_back(std::move(m.trailer));
+            benchmark::DoNotOptimize(m.legacy);
+            return buffers;
+        });
+    }
+
+    auto take_buffers(std::vector<buffer>& buffers)
+    {
+        return [&](auto&& field) {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(field)>, buffer>)
+            {
+                buffers.push_back(std::move(field));
+            }
+            else
+            {
+                benchmark::DoNotOptimize(field);
+            }
+        };
+    }
+
+    void for_each_field_visit(benchmark::State& state)
+    {
+        run(state, [](message&& m) {
+            auto buffers = std::vector<buffer>();
+            buffers.reserve(3);
+            for_each_field(std::move(m), take_buffers(buffers));
+            return buffers;
+        });
+    }
+
+    // visit through a moved tuple of all fields
+    void to_tuple_visit(benchmark::State& state)
+    {
+        run(state, [](message&& m) {
+            auto buffers = std::vector<buffer>();
+            buffers.reserve(3);
+            std::apply([&](auto&&... fields) { (take_buffers(buffers)(std::move(fields)), ...); },
+                       to_tuple(std::move(m)));
+            return buffers;
+        });
+    }
+}  // namespace
+
+BENCHMARK(manual_extract);
+BENCHMARK(get_field_extract);
+BENCHMARK(to_tuple_extract);
+BENCHMARK(manual_visit);
+BENCHMARK(for_each_field_visit);
+BENCHMARK(to_tuple_visit);
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "field_reflection/soa_vector.hpp"
+
+using namespace field_reflection;
+
+namespace
+{
+    // 64 bytes per row, of which a scan reads 12
+    struct order
+    {
+        std::uint64_t id;
+        std::uint64_t customer;
+        double price;
+        std::uint32_t quantity;
+        std::uint32_t status;
+        double discount;
+        double tax;
+        std::uint64_t created;
+        std::uint64_t updated;
+    };
+
+    order make_order(std::mt19937_64& rng)
+    {
+        auto dist = std::uniform_real_distribution<double>(1.0, 100.0);
+        return {rng(), rng(), dist(rng), static_cast<std::uint32_t>(rng() % 10), 0, 0.0, 0.0, rng(), rng()};
+    }
+
+    void aos_scan(benchmark::State& state)
+    {
+        auto rng = std::mt19937_64(42);
+        auto orders = std::vector<order>();
+        orders.reserve(static_cast<std::size_t>(state.range(0)));
+        for (auto i = 0; i < state.range(0); ++i) orders.push_back(make_order(rng));
+
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto& o : orders) total += o.price * o.quantity;
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(order)));
+    }
+
+    void soa_scan(benchmark::State& state)
+    {
+        auto rng = std::mt19937_64(42);
+        auto orders = soa_vector<order>();
+        orders.reserve(static_cast<std::size_t>(state.range(0)));
+        for (auto i = 0; i < state.range(0); ++i) orders.push_back(make_order(rng));
+
+        for (auto _ : state)
+        {
+            const auto prices = orders.column<2>();
+            const auto quantities = orders.column<3>();
+            auto total = 0.0;
+            for (std::size_t i = 0; i < prices.size(); ++i) total += prices[i] * quantities[i];
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(order)));
+    }
+
+    void soa_proxy_scan(benchmark::State& state)
+    {
+        auto rng = std::mt19937_64(42);
+        auto orders = soa_vector<order>();
+        for (auto i = 0; i < state.range(0); ++i) orders.push_back(make_order(rng));
+
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto o : orders) total += get_field<2>(o) * get_field<3>(o);
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(order)));
+    }
+}  // namespace
+
+BENCHMARK(aos_scan)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(soa_scan)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(soa_proxy_scan)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "field_reflection.hpp"
+
+using namespace field_reflection;
+
+namespace
+{
+    struct record
+    {
+        std::uint64_t id;
+        double price;
+        std::int32_t quantity;
+        std::uint16_t flags;
+        std::uint8_t kind;
+        bool active;
+        double tax;
+        std::uint64_t timestamp;
+    };
+
+    std::vector<record> make_records(std::int64_t n)
+    {
+        auto rng = std::mt19937_64(42);
+        auto dist = std::uniform_real_distribution<double>(1.0, 100.0);
+        auto records = std::vector<record>();
+        records.reserve(static_cast<std::size_t>(n));
+        for (auto i = 0; i < n; ++i)
+        {
+            records.push_back({rng(), dist(rng), static_cast<std::int32_t>(rng() % 10),
+                               static_cast<std::uint16_t>(rng()), static_cast<std::uint8_t>(rng()), rng() % 2 == 0,
+                               dist(rng), rng()});
+        }
+        return records;
+    }
+
+    void manual_sum(benchmark::State& state)
+    {
+        const auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto& r : records)
+            {
+                total += static_cast<double>(r.id);
+                total += r.price;
+                total += r.quantity;
+                total += r.flags;
+                total += r.kind;
+                total += r.active;
+                total += r.tax;
+                total += static_cast<double>(r.timestamp);
+            }
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void for_each_field_sum(benchmark::State& state)
+    {
+        const auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto& r : records) for_each_field(r, [&](auto field) { total += static_cast<double>(field); });
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void manual_update(benchmark::State& state)
+    {
+        auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            for (auto& r : records)
+            {
+                r.price *= 1.01;
+                r.tax *= 1.01;
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void for_each_field_update(benchmark::State& state)
+    {
+        auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            for (auto& r : records)
+            {
+                for_each_field(r, [](auto& field) {
+                    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(field)>, double>) field *= 1.01;
+                });
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void manual_get(benchmark::State& state)
+    {
+        const auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto& r : records) total += r.price * r.quantity;
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void get_field_get(benchmark::State& state)
+    {
+        const auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto& r : records) total += get_field<1>(r) * get_field<2>(r);
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void to_tuple_get(benchmark::State& state)
+    {
+        const auto records = make_records(state.range(0));
+        for (auto _ : state)
+        {
+            auto total = 0.0;
+            for (const auto& r : records)
+            {
+                const auto t = to_tuple(r);
+                total += std::get<1>(t) * std::get<2>(t);
+            }
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}  // namespace
+
+BENCHMARK(manual_sum)->Range(1 << 10, 1 << 20);
+BENCHMARK(for_each_field_sum)->Range(1 << 10, 1 << 20);
+BENCHMARK(manual_update)->Range(1 << 10, 1 << 20);
+BENCHMARK(for_each_field_update)->Range(1 << 10, 1 << 20);
+BENCHMARK(manual_get)->Range(1 << 10, 1 << 20);
+BENCHMARK(get_field_get)->Range(1 << 10, 1 << 20);
+BENCHMARK(to_tuple_get)->Range(1 << 10, 1 << 20);
@@ -10,15 +10,30 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cassert>
 #include <climits>  // CHAR_BIT
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <limits>
+#include <optional>
 #include <source_location>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+// The maximum number of fields in a struct. Defining a larger value (up to 512, or unlimited with structured binding
+// packs) before including this header supports wider structs at the cost of compile time.
+#ifndef FIELD_RFL_MAX_FIELDS
+#define FIELD_RFL_MAX_FIELDS 100
+#endif
+
 namespace field_reflection
 {
     namespace detail
@@ -113,21 +128,46 @@ namespace field_reflection
             }
         }();
 
-        constexpr std::size_t macro_max_fields_count = 100;
+        constexpr std::size_t macro_max_fields_count = FIELD_RFL_MAX_FIELDS;
         template <typename T>
         constexpr auto max_field_count =
             std::min(std::size_t{macro_max_fields_count}, sizeof(T) * CHAR_BIT);  // in consideration of bit field
 
+        // The argument counts for which T is brace-initializable form a contiguous range [first, count], where the
+        // leading gap is caused by members that cannot be value-initialized (e.g. references). Given Lo in the range,
+        // the largest one in [Lo, Hi] is found by binary search.
+        template <typename T, std::size_t Lo, std::size_t Hi>
+        constexpr std::size_t field_count_search = []() {
+            if constexpr (Lo == Hi)
+            {
+                return Lo;
+            }
+            else
+            {
+                constexpr auto mid = Lo + (Hi - Lo + 1) / 2;
+                if constexpr (constructible<T, mid>)
+                {
+                    return field_count_search<T, mid, Hi>;
+                }
+                else
+                {
+                    return field_count_search<T, Lo, mid - 1>;
+                }
+            }
+        }();
+
         template <typename T, std::size_t N>
         requires std::is_aggregate_v<T>
         constexpr std::size_t field_count_impl = []() {
-            if constexpr (N >= max_field_count<T>)
+            if constexpr (N > max_field_count<T>)
             {
                 return std::numeric_limits<std::size_t>::max();
             }
-            else if constexpr (constructible<T, N> && !constructible<T, N + 1>)
+            else if constexpr (constructible<T, N>)
             {
-                return N;
+                // probe one past the limit to reject structs with too many fields
+                constexpr auto count = field_count_search<T, N, max_field_count<T> + 1>;
+                return count > max_field_count<T> ? std::numeric_limits<std::size_t>::max() : count;
             }
             else
             {
@@ -152,18 +192,37 @@ namespace field_reflection
         template <typename>
         constexpr bool always_false = false;
 
+#define FIELD_RFL_STRINGIZE_IMPL(x) #x
+#define FIELD_RFL_STRINGIZE(x) FIELD_RFL_STRINGIZE_IMPL(x)
         template <typename T, field_referenceable U = std::remove_cvref_t<T>>
         constexpr auto to_ptr_tuple(T&&)
         {
-            static_assert(always_false<U>, "The supported maximum number of fields in struct must be <= 100.");
+            static_assert(always_false<U>,
+                          "The supported maximum number of fields in struct must be <= " FIELD_RFL_STRINGIZE(
+                              FIELD_RFL_MAX_FIELDS) ".");
+        }
+        template <typename T, typename Func, field_referenceable U = std::remove_cvref_t<T>>
+        constexpr void invoke_with_fields(T&&, Func&&)
+        {
+            static_assert(always_false<U>,
+                          "The supported maximum number of fields in struct must be <= " FIELD_RFL_STRINGIZE(
+                              FIELD_RFL_MAX_FIELDS) ".");
         }
         template <field_referenceable T>
         constexpr auto field_type_tuple()
         {
-            static_assert(always_false<T>, "The supported maximum number of fields in struct must be <= 100.");
+            static_assert(always_false<T>,
+                          "The supported maximum number of fields in struct must be <= " FIELD_RFL_STRINGIZE(
+                              FIELD_RFL_MAX_FIELDS) ".");
         }
+#undef FIELD_RFL_STRINGIZE
+#undef FIELD_RFL_STRINGIZE_IMPL
         template <typename T>
         inline T* field_type_source = nullptr;
+        // a field of an rvalue is passed as an rvalue reference unless it is a reference member
+        template <typename T, typename Field>
+        using forwarded_field_t =
+            std::conditional_t<std::is_rvalue_reference_v<T&&> && !std::is_reference_v<Field>, Field&&, Field&>;
         template <typename T, field_referenceable U = std::remove_cvref_t<T>>
         requires (field_count<U> == 0)
         constexpr auto to_ptr_tuple(T&&)
@@ -176,6 +235,12 @@ namespace field_reflection
         {
             return std::tie();
         }
+        template <typename T, typename Func, field_referenceable U = std::remove_cvref_t<T>>
+        requires (field_count<U> == 0)
+        constexpr decltype(auto) invoke_with_fields(T&&, Func&& func)
+        {
+            return std::forward<Func>(func)();
+        }
         template <field_referenceable T>
         requires (field_count<T> == 0)
         constexpr auto field_type_tuple()
@@ -184,406 +249,1746 @@ namespace field_reflection
         }
 
 #pragma region TO_TUPLE_TEMPLATE_MACRO
-// map macro: https://github.com/swansontec/map-macro
-#define FIELD_RFL_EVAL0(...) __VA_ARGS__
-#define FIELD_RFL_EVAL1(...) FIELD_RFL_EVAL0(FIELD_RFL_EVAL0(FIELD_RFL_EVAL0(__VA_ARGS__)))
-#define FIELD_RFL_EVAL2(...) FIELD_RFL_EVAL1(FIELD_RFL_EVAL1(FIELD_RFL_EVAL1(__VA_ARGS__)))
-#define FIELD_RFL_EVAL3(...) FIELD_RFL_EVAL2(FIELD_RFL_EVAL2(FIELD_RFL_EVAL2(__VA_ARGS__)))
-#define FIELD_RFL_EVAL4(...) FIELD_RFL_EVAL3(FIELD_RFL_EVAL3(FIELD_RFL_EVAL3(__VA_ARGS__)))
-#define FIELD_RFL_EVAL(...) FIELD_RFL_EVAL4(FIELD_RFL_EVAL4(FIELD_RFL_EVAL4(__VA_ARGS__)))
-
-#define FIELD_RFL_MAP_END(...)
-#define FIELD_RFL_MAP_OUT
-#define FIELD_RFL_MAP_COMMA ,
-
-#define FIELD_RFL_MAP_GET_END2() 0, FIELD_RFL_MAP_END
-#define FIELD_RFL_MAP_GET_END1(...) FIELD_RFL_MAP_GET_END2
-#define FIELD_RFL_MAP_GET_END(...) FIELD_RFL_MAP_GET_END1
-#define FIELD_RFL_MAP_NEXT0(test, next, ...) next FIELD_RFL_MAP_OUT
-#define FIELD_RFL_MAP_NEXT1(test, next) FIELD_RFL_MAP_NEXT0(test, next, 0)
-#define FIELD_RFL_MAP_NEXT(test, next) FIELD_RFL_MAP_NEXT1(FIELD_RFL_MAP_GET_END test, next)
-
-#define FIELD_RFL_MAP0(f, x, peek, ...) f(x) FIELD_RFL_MAP_NEXT(peek, FIELD_RFL_MAP1)(f, peek, __VA_ARGS__)
-#define FIELD_RFL_MAP1(f, x, peek, ...) f(x) FIELD_RFL_MAP_NEXT(peek, FIELD_RFL_MAP0)(f, peek, __VA_ARGS__)
-
-#define FIELD_RFL_MAP_LIST_NEXT1(test, next) FIELD_RFL_MAP_NEXT0(test, FIELD_RFL_MAP_COMMA next, 0)
-#define FIELD_RFL_MAP_LIST_NEXT(test, next) FIELD_RFL_MAP_LIST_NEXT1(FIELD_RFL_MAP_GET_END test, next)
-
-#define FIELD_RFL_MAP_LIST0(f, x, peek, ...) \
-    f(x) FIELD_RFL_MAP_LIST_NEXT(peek, FIELD_RFL_MAP_LIST1)(f, peek, __VA_ARGS__)
-#define FIELD_RFL_MAP_LIST1(f, x, peek, ...) \
-    f(x) FIELD_RFL_MAP_LIST_NEXT(peek, FIELD_RFL_MAP_LIST0)(f, peek, __VA_ARGS__)
-#define FIELD_RFL_MAP(f, ...) FIELD_RFL_EVAL(FIELD_RFL_MAP1(f, __VA_ARGS__, ()()(), ()()(), ()()(), 0))
-#define FIELD_RFL_MAP_LIST(f, ...) FIELD_RFL_EVAL(FIELD_RFL_MAP_LIST1(f, __VA_ARGS__, ()()(), ()()(), ()()(), 0))
-
+#if defined(__cpp_structured_bindings) && __cpp_structured_bindings >= 202411L
+        // structured binding packs (P1061)
+        template <typename T, field_referenceable U = std::remove_cvref_t<T>>
+        requires (field_count<U> > 0)
+        constexpr auto to_ptr_tuple(T&& t)
+        {
+            auto& [... p] = t;
+            return std::tuple(&p...);
+        }
+        template <typename T, field_referenceable U = std::remove_cvref_t<T>>
+        requires (field_count<U> > 0)
+        constexpr auto to_tuple(T&& t)
+        {
+            auto [... p] = std::forward<T>(t);
+            return std::tuple<decltype(p)...>(std::forward<decltype(p)>(p)...);
+        }
+        template <typename T, typename Func, field_referenceable U = std::remove_cvref_t<T>>
+        requires (field_count<U> > 0)
+        constexpr decltype(auto) invoke_with_fields(T&& t, Func&& func)
+        {
+            auto& [... p] = t;
+            return std::forward<Func>(func)(static_cast<forwarded_field_t<T, decltype(p)>>(p)...);
+        }
+        template <field_referenceable T>
+        requires (field_count<T> > 0)
+        constexpr auto field_type_tuple()
+        {
+            auto&& [... p] = *field_type_source<T>;
+            return std::type_identity<std::tuple<decltype(p)...>>{};
+        }
+#else
+#if FIELD_RFL_MAX_FIELDS > 512
+#error "FIELD_RFL_MAX_FIELDS must be <= 512 unless the compiler supports structured binding packs"
+#endif
+#define FIELD_RFL_IDENTITY(x) x
 #define FIELD_RFL_ADDR(x) &x
 #define FIELD_RFL_DECLTYPE(x) decltype(x)
 #define FIELD_RFL_FORWARD(x) std::forward<decltype(x)>(x)
-#define FIELD_RFL_FIELD_TYPE(x) decltype(x)
+#define FIELD_RFL_FORWARD_FIELD(x) static_cast<forwarded_field_t<T, decltype(x)>>(x)
 
-#define TO_TUPLE_TEMPLATE(NUM, ...)                                                                     \
+#define TO_TUPLE_TEMPLATE(NUM)                                                                          \
     template <typename T, field_referenceable U = std::remove_cvref_t<T>>                               \
     requires (field_count<U> == NUM)                                                                    \
     constexpr auto to_ptr_tuple(T&& t)                                                                  \
     {                                                                                                   \
-        auto& [__VA_ARGS__] = t;                                                                        \
-        return std::tuple(FIELD_RFL_MAP_LIST(FIELD_RFL_ADDR, __VA_ARGS__));                             \
+        auto& [FIELD_RFL_FIELDS_##NUM(FIELD_RFL_IDENTITY)] = t;                                         \
+        return std::tuple(FIELD_RFL_FIELDS_##NUM(FIELD_RFL_ADDR));                                      \
     }                                                                                                   \
     template <typename T, field_referenceable U = std::remove_cvref_t<T>>                               \
     requires (field_count<U> == NUM)                                                                    \
     constexpr auto to_tuple(T&& t)                                                                      \
     {                                                                                                   \
-        auto [__VA_ARGS__] = std::forward<T>(t);                                                        \
-        return std::tuple<FIELD_RFL_MAP_LIST(FIELD_RFL_DECLTYPE, __VA_ARGS__)>(                         \
-            FIELD_RFL_MAP_LIST(FIELD_RFL_FORWARD, __VA_ARGS__));                                        \
+        auto [FIELD_RFL_FIELDS_##NUM(FIELD_RFL_IDENTITY)] = std::forward<T>(t);                         \
+        return std::tuple<FIELD_RFL_FIELDS_##NUM(FIELD_RFL_DECLTYPE)>(                                  \
+            FIELD_RFL_FIELDS_##NUM(FIELD_RFL_FORWARD));                                                 \
+    }                                                                                                   \
+    template <typename T, typename Func, field_referenceable U = std::remove_cvref_t<T>>                \
+    requires (field_count<U> == NUM)                                                                    \
+    constexpr decltype(auto) invoke_with_fields(T&& t, Func&& func)                                     \
+    {                                                                                                   \
+        auto& [FIELD_RFL_FIELDS_##NUM(FIELD_RFL_IDENTITY)] = t;                                         \
+        return std::forward<Func>(func)(FIELD_RFL_FIELDS_##NUM(FIELD_RFL_FORWARD_FIELD));               \
     }                                                                                                   \
     template <field_referenceable T>                                                                    \
     requires (field_count<T> == NUM)                                                                    \
     constexpr auto field_type_tuple()                                                                   \
     {                                                                                                   \
-        auto&& [__VA_ARGS__] = *field_type_source<T>;                                                   \
-        return std::type_identity<std::tuple<FIELD_RFL_MAP_LIST(FIELD_RFL_FIELD_TYPE, __VA_ARGS__)>>{}; \
+        auto&& [FIELD_RFL_FIELDS_##NUM(FIELD_RFL_IDENTITY)] = *field_type_source<T>;                    \
+        return std::type_identity<std::tuple<FIELD_RFL_FIELDS_##NUM(FIELD_RFL_DECLTYPE)>>{};            \
     }
 
-        TO_TUPLE_TEMPLATE(1, p0)
-        TO_TUPLE_TEMPLATE(2, p0, p1)
-        TO_TUPLE_TEMPLATE(3, p0, p1, p2)
-        TO_TUPLE_TEMPLATE(4, p0, p1, p2, p3)
-        TO_TUPLE_TEMPLATE(5, p0, p1, p2, p3, p4)
-        TO_TUPLE_TEMPLATE(6, p0, p1, p2, p3, p4, p5)
-        TO_TUPLE_TEMPLATE(7, p0, p1, p2, p3, p4, p5, p6)
-        TO_TUPLE_TEMPLATE(8, p0, p1, p2, p3, p4, p5, p6, p7)
-        TO_TUPLE_TEMPLATE(9, p0, p1, p2, p3, p4, p5, p6, p7, p8)
-        TO_TUPLE_TEMPLATE(10, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9)
-        TO_TUPLE_TEMPLATE(11, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10)
-        TO_TUPLE_TEMPLATE(12, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11)
-        TO_TUPLE_TEMPLATE(13, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12)
-        TO_TUPLE_TEMPLATE(14, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13)
-        TO_TUPLE_TEMPLATE(15, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14)
-        TO_TUPLE_TEMPLATE(16, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15)
-        TO_TUPLE_TEMPLATE(17, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16)
-        TO_TUPLE_TEMPLATE(18, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17)
-        TO_TUPLE_TEMPLATE(19, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18)
-        TO_TUPLE_TEMPLATE(20, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19)
-        TO_TUPLE_TEMPLATE(21, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20)
-        TO_TUPLE_TEMPLATE(22, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21)
-        TO_TUPLE_TEMPLATE(23, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22)
-        TO_TUPLE_TEMPLATE(24, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23)
-        TO_TUPLE_TEMPLATE(25, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24)
-        TO_TUPLE_TEMPLATE(26, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25)
-        TO_TUPLE_TEMPLATE(27, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26)
-        TO_TUPLE_TEMPLATE(28, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27)
-        TO_TUPLE_TEMPLATE(29, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28)
-        TO_TUPLE_TEMPLATE(30, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29)
-        TO_TUPLE_TEMPLATE(31, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30)
-        TO_TUPLE_TEMPLATE(32, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31)
-        TO_TUPLE_TEMPLATE(33, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32)
-        TO_TUPLE_TEMPLATE(34, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33)
-        TO_TUPLE_TEMPLATE(35, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34)
-        TO_TUPLE_TEMPLATE(36, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35)
-        TO_TUPLE_TEMPLATE(37, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36)
-        TO_TUPLE_TEMPLATE(38, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37)
-        TO_TUPLE_TEMPLATE(39, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38)
-        TO_TUPLE_TEMPLATE(40, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39)
-        TO_TUPLE_TEMPLATE(41, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40)
-        TO_TUPLE_TEMPLATE(42, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41)
-        TO_TUPLE_TEMPLATE(43, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42)
-        TO_TUPLE_TEMPLATE(44, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43)
-        TO_TUPLE_TEMPLATE(45, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44)
-        TO_TUPLE_TEMPLATE(46, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45)
-        TO_TUPLE_TEMPLATE(47, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46)
-        TO_TUPLE_TEMPLATE(48, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47)
-        TO_TUPLE_TEMPLATE(49, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48)
-        TO_TUPLE_TEMPLATE(50, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49)
-        TO_TUPLE_TEMPLATE(51, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50)
-        TO_TUPLE_TEMPLATE(52, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51)
-        TO_TUPLE_TEMPLATE(53, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52)
-        TO_TUPLE_TEMPLATE(54, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53)
-        TO_TUPLE_TEMPLATE(55, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54)
-        TO_TUPLE_TEMPLATE(56, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55)
-        TO_TUPLE_TEMPLATE(57, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56)
-        TO_TUPLE_TEMPLATE(58, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57)
-        TO_TUPLE_TEMPLATE(59, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58)
-        TO_TUPLE_TEMPLATE(60, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59)
-        TO_TUPLE_TEMPLATE(61, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60)
-        TO_TUPLE_TEMPLATE(62, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61)
-        TO_TUPLE_TEMPLATE(63, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62)
-        TO_TUPLE_TEMPLATE(64, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63)
-        TO_TUPLE_TEMPLATE(65, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64)
-        TO_TUPLE_TEMPLATE(66, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65)
-        TO_TUPLE_TEMPLATE(67, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66)
-        TO_TUPLE_TEMPLATE(68, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67)
-        TO_TUPLE_TEMPLATE(69, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68)
-        TO_TUPLE_TEMPLATE(70, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69)
-        TO_TUPLE_TEMPLATE(71, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70)
-        TO_TUPLE_TEMPLATE(72, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71)
-        TO_TUPLE_TEMPLATE(73, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72)
-        TO_TUPLE_TEMPLATE(74, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73)
-        TO_TUPLE_TEMPLATE(75, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74)
-        TO_TUPLE_TEMPLATE(76, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75)
-        TO_TUPLE_TEMPLATE(77, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76)
-        TO_TUPLE_TEMPLATE(78, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77)
-        TO_TUPLE_TEMPLATE(79, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78)
-        TO_TUPLE_TEMPLATE(80, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79)
-        TO_TUPLE_TEMPLATE(81, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80)
-        TO_TUPLE_TEMPLATE(82, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81)
-        TO_TUPLE_TEMPLATE(83, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82)
-        TO_TUPLE_TEMPLATE(84, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83)
-        TO_TUPLE_TEMPLATE(85, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84)
-        TO_TUPLE_TEMPLATE(86, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85)
-        TO_TUPLE_TEMPLATE(87, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86)
-        TO_TUPLE_TEMPLATE(88, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87)
-        TO_TUPLE_TEMPLATE(89, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88)
-        TO_TUPLE_TEMPLATE(90, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89)
-        TO_TUPLE_TEMPLATE(91, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90)
-        TO_TUPLE_TEMPLATE(92, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91)
-        TO_TUPLE_TEMPLATE(93, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92)
-        TO_TUPLE_TEMPLATE(94, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93)
-        TO_TUPLE_TEMPLATE(95, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94)
-        TO_TUPLE_TEMPLATE(96, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95)
-        TO_TUPLE_TEMPLATE(97, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95,
-                          p96)
-        TO_TUPLE_TEMPLATE(98, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95,
-                          p96, p97)
-        TO_TUPLE_TEMPLATE(99, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95,
-                          p96, p97, p98)
-        TO_TUPLE_TEMPLATE(100, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18, p19,
-                          p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32, p33, p34, p35, p36, p37, p38,
-                          p39, p40, p41, p42, p43, p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-                          p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76,
-                          p77, p78, p79, p80, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95,
-                          p96, p97, p98, p99)
-#undef FIELD_RFL_EVAL0
-#undef FIELD_RFL_EVAL1
-#undef FIELD_RFL_EVAL2
-#undef FIELD_RFL_EVAL3
-#undef FIELD_RFL_EVAL4
-#undef FIELD_RFL_EVAL
-#undef FIELD_RFL_MAP_END
-#undef FIELD_RFL_MAP_OUT
-#undef FIELD_RFL_MAP_COMMA
-#undef FIELD_RFL_MAP_GET_END2
-#undef FIELD_RFL_MAP_GET_END1
-#undef FIELD_RFL_MAP_GET_END
-#undef FIELD_RFL_MAP_NEXT0
-#undef FIELD_RFL_MAP_NEXT1
-#undef FIELD_RFL_MAP_NEXT
-#undef FIELD_RFL_MAP0
-#undef FIELD_RFL_MAP1
-#undef FIELD_RFL_MAP_LIST_NEXT1
-#undef FIELD_RFL_MAP_LIST_NEXT
-#undef FIELD_RFL_MAP_LIST0
-#undef FIELD_RFL_MAP_LIST1
-#undef FIELD_RFL_MAP
-#undef FIELD_RFL_MAP_LIST
+// FIELD_RFL_FIELDS_N(f) expands to f(p0), f(p1), ..., f(pN-1). The overloads are defined in chunks of 16 up to the
+// configured FIELD_RFL_MAX_FIELDS so that the default configuration does not pay for the larger ones.
+#define FIELD_RFL_FIELDS_1(f) f(p0)
+#define FIELD_RFL_FIELDS_2(f) FIELD_RFL_FIELDS_1(f), f(p1)
+#define FIELD_RFL_FIELDS_3(f) FIELD_RFL_FIELDS_2(f), f(p2)
+#define FIELD_RFL_FIELDS_4(f) FIELD_RFL_FIELDS_3(f), f(p3)
+#define FIELD_RFL_FIELDS_5(f) FIELD_RFL_FIELDS_4(f), f(p4)
+#define FIELD_RFL_FIELDS_6(f) FIELD_RFL_FIELDS_5(f), f(p5)
+#define FIELD_RFL_FIELDS_7(f) FIELD_RFL_FIELDS_6(f), f(p6)
+#define FIELD_RFL_FIELDS_8(f) FIELD_RFL_FIELDS_7(f), f(p7)
+#define FIELD_RFL_FIELDS_9(f) FIELD_RFL_FIELDS_8(f), f(p8)
+#define FIELD_RFL_FIELDS_10(f) FIELD_RFL_FIELDS_9(f), f(p9)
+#define FIELD_RFL_FIELDS_11(f) FIELD_RFL_FIELDS_10(f), f(p10)
+#define FIELD_RFL_FIELDS_12(f) FIELD_RFL_FIELDS_11(f), f(p11)
+#define FIELD_RFL_FIELDS_13(f) FIELD_RFL_FIELDS_12(f), f(p12)
+#define FIELD_RFL_FIELDS_14(f) FIELD_RFL_FIELDS_13(f), f(p13)
+#define FIELD_RFL_FIELDS_15(f) FIELD_RFL_FIELDS_14(f), f(p14)
+#define FIELD_RFL_FIELDS_16(f) FIELD_RFL_FIELDS_15(f), f(p15)
+        TO_TUPLE_TEMPLATE(1)
+        TO_TUPLE_TEMPLATE(2)
+        TO_TUPLE_TEMPLATE(3)
+        TO_TUPLE_TEMPLATE(4)
+        TO_TUPLE_TEMPLATE(5)
+        TO_TUPLE_TEMPLATE(6)
+        TO_TUPLE_TEMPLATE(7)
+        TO_TUPLE_TEMPLATE(8)
+        TO_TUPLE_TEMPLATE(9)
+        TO_TUPLE_TEMPLATE(10)
+        TO_TUPLE_TEMPLATE(11)
+        TO_TUPLE_TEMPLATE(12)
+        TO_TUPLE_TEMPLATE(13)
+        TO_TUPLE_TEMPLATE(14)
+        TO_TUPLE_TEMPLATE(15)
+        TO_TUPLE_TEMPLATE(16)
+#if FIELD_RFL_MAX_FIELDS > 16
+#define FIELD_RFL_FIELDS_17(f) FIELD_RFL_FIELDS_16(f), f(p16)
+#define FIELD_RFL_FIELDS_18(f) FIELD_RFL_FIELDS_17(f), f(p17)
+#define FIELD_RFL_FIELDS_19(f) FIELD_RFL_FIELDS_18(f), f(p18)
+#define FIELD_RFL_FIELDS_20(f) FIELD_RFL_FIELDS_19(f), f(p19)
+#define FIELD_RFL_FIELDS_21(f) FIELD_RFL_FIELDS_20(f), f(p20)
+#define FIELD_RFL_FIELDS_22(f) FIELD_RFL_FIELDS_21(f), f(p21)
+#define FIELD_RFL_FIELDS_23(f) FIELD_RFL_FIELDS_22(f), f(p22)
+#define FIELD_RFL_FIELDS_24(f) FIELD_RFL_FIELDS_23(f), f(p23)
+#define FIELD_RFL_FIELDS_25(f) FIELD_RFL_FIELDS_24(f), f(p24)
+#define FIELD_RFL_FIELDS_26(f) FIELD_RFL_FIELDS_25(f), f(p25)
+#define FIELD_RFL_FIELDS_27(f) FIELD_RFL_FIELDS_26(f), f(p26)
+#define FIELD_RFL_FIELDS_28(f) FIELD_RFL_FIELDS_27(f), f(p27)
+#define FIELD_RFL_FIELDS_29(f) FIELD_RFL_FIELDS_28(f), f(p28)
+#define FIELD_RFL_FIELDS_30(f) FIELD_RFL_FIELDS_29(f), f(p29)
+#define FIELD_RFL_FIELDS_31(f) FIELD_RFL_FIELDS_30(f), f(p30)
+#define FIELD_RFL_FIELDS_32(f) FIELD_RFL_FIELDS_31(f), f(p31)
+        TO_TUPLE_TEMPLATE(17)
+        TO_TUPLE_TEMPLATE(18)
+        TO_TUPLE_TEMPLATE(19)
+        TO_TUPLE_TEMPLATE(20)
+        TO_TUPLE_TEMPLATE(21)
+        TO_TUPLE_TEMPLATE(22)
+        TO_TUPLE_TEMPLATE(23)
+        TO_TUPLE_TEMPLATE(24)
+        TO_TUPLE_TEMPLATE(25)
+        TO_TUPLE_TEMPLATE(26)
+        TO_TUPLE_TEMPLATE(27)
+        TO_TUPLE_TEMPLATE(28)
+        TO_TUPLE_TEMPLATE(29)
+        TO_TUPLE_TEMPLATE(30)
+        TO_TUPLE_TEMPLATE(31)
+        TO_TUPLE_TEMPLATE(32)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 32
+#define FIELD_RFL_FIELDS_33(f) FIELD_RFL_FIELDS_32(f), f(p32)
+#define FIELD_RFL_FIELDS_34(f) FIELD_RFL_FIELDS_33(f), f(p33)
+#define FIELD_RFL_FIELDS_35(f) FIELD_RFL_FIELDS_34(f), f(p34)
+#define FIELD_RFL_FIELDS_36(f) FIELD_RFL_FIELDS_35(f), f(p35)
+#define FIELD_RFL_FIELDS_37(f) FIELD_RFL_FIELDS_36(f), f(p36)
+#define FIELD_RFL_FIELDS_38(f) FIELD_RFL_FIELDS_37(f), f(p37)
+#define FIELD_RFL_FIELDS_39(f) FIELD_RFL_FIELDS_38(f), f(p38)
+#define FIELD_RFL_FIELDS_40(f) FIELD_RFL_FIELDS_39(f), f(p39)
+#define FIELD_RFL_FIELDS_41(f) FIELD_RFL_FIELDS_40(f), f(p40)
+#define FIELD_RFL_FIELDS_42(f) FIELD_RFL_FIELDS_41(f), f(p41)
+#define FIELD_RFL_FIELDS_43(f) FIELD_RFL_FIELDS_42(f), f(p42)
+#define FIELD_RFL_FIELDS_44(f) FIELD_RFL_FIELDS_43(f), f(p43)
+#define FIELD_RFL_FIELDS_45(f) FIELD_RFL_FIELDS_44(f), f(p44)
+#define FIELD_RFL_FIELDS_46(f) FIELD_RFL_FIELDS_45(f), f(p45)
+#define FIELD_RFL_FIELDS_47(f) FIELD_RFL_FIELDS_46(f), f(p46)
+#define FIELD_RFL_FIELDS_48(f) FIELD_RFL_FIELDS_47(f), f(p47)
+        TO_TUPLE_TEMPLATE(33)
+        TO_TUPLE_TEMPLATE(34)
+        TO_TUPLE_TEMPLATE(35)
+        TO_TUPLE_TEMPLATE(36)
+        TO_TUPLE_TEMPLATE(37)
+        TO_TUPLE_TEMPLATE(38)
+        TO_TUPLE_TEMPLATE(39)
+        TO_TUPLE_TEMPLATE(40)
+        TO_TUPLE_TEMPLATE(41)
+        TO_TUPLE_TEMPLATE(42)
+        TO_TUPLE_TEMPLATE(43)
+        TO_TUPLE_TEMPLATE(44)
+        TO_TUPLE_TEMPLATE(45)
+        TO_TUPLE_TEMPLATE(46)
+        TO_TUPLE_TEMPLATE(47)
+        TO_TUPLE_TEMPLATE(48)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 48
+#define FIELD_RFL_FIELDS_49(f) FIELD_RFL_FIELDS_48(f), f(p48)
+#define FIELD_RFL_FIELDS_50(f) FIELD_RFL_FIELDS_49(f), f(p49)
+#define FIELD_RFL_FIELDS_51(f) FIELD_RFL_FIELDS_50(f), f(p50)
+#define FIELD_RFL_FIELDS_52(f) FIELD_RFL_FIELDS_51(f), f(p51)
+#define FIELD_RFL_FIELDS_53(f) FIELD_RFL_FIELDS_52(f), f(p52)
+#define FIELD_RFL_FIELDS_54(f) FIELD_RFL_FIELDS_53(f), f(p53)
+#define FIELD_RFL_FIELDS_55(f) FIELD_RFL_FIELDS_54(f), f(p54)
+#define FIELD_RFL_FIELDS_56(f) FIELD_RFL_FIELDS_55(f), f(p55)
+#define FIELD_RFL_FIELDS_57(f) FIELD_RFL_FIELDS_56(f), f(p56)
+#define FIELD_RFL_FIELDS_58(f) FIELD_RFL_FIELDS_57(f), f(p57)
+#define FIELD_RFL_FIELDS_59(f) FIELD_RFL_FIELDS_58(f), f(p58)
+#define FIELD_RFL_FIELDS_60(f) FIELD_RFL_FIELDS_59(f), f(p59)
+#define FIELD_RFL_FIELDS_61(f) FIELD_RFL_FIELDS_60(f), f(p60)
+#define FIELD_RFL_FIELDS_62(f) FIELD_RFL_FIELDS_61(f), f(p61)
+#define FIELD_RFL_FIELDS_63(f) FIELD_RFL_FIELDS_62(f), f(p62)
+#define FIELD_RFL_FIELDS_64(f) FIELD_RFL_FIELDS_63(f), f(p63)
+        TO_TUPLE_TEMPLATE(49)
+        TO_TUPLE_TEMPLATE(50)
+        TO_TUPLE_TEMPLATE(51)
+        TO_TUPLE_TEMPLATE(52)
+        TO_TUPLE_TEMPLATE(53)
+        TO_TUPLE_TEMPLATE(54)
+        TO_TUPLE_TEMPLATE(55)
+        TO_TUPLE_TEMPLATE(56)
+        TO_TUPLE_TEMPLATE(57)
+        TO_TUPLE_TEMPLATE(58)
+        TO_TUPLE_TEMPLATE(59)
+        TO_TUPLE_TEMPLATE(60)
+        TO_TUPLE_TEMPLATE(61)
+        TO_TUPLE_TEMPLATE(62)
+        TO_TUPLE_TEMPLATE(63)
+        TO_TUPLE_TEMPLATE(64)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 64
+#define FIELD_RFL_FIELDS_65(f) FIELD_RFL_FIELDS_64(f), f(p64)
+#define FIELD_RFL_FIELDS_66(f) FIELD_RFL_FIELDS_65(f), f(p65)
+#define FIELD_RFL_FIELDS_67(f) FIELD_RFL_FIELDS_66(f), f(p66)
+#define FIELD_RFL_FIELDS_68(f) FIELD_RFL_FIELDS_67(f), f(p67)
+#define FIELD_RFL_FIELDS_69(f) FIELD_RFL_FIELDS_68(f), f(p68)
+#define FIELD_RFL_FIELDS_70(f) FIELD_RFL_FIELDS_69(f), f(p69)
+#define FIELD_RFL_FIELDS_71(f) FIELD_RFL_FIELDS_70(f), f(p70)
+#define FIELD_RFL_FIELDS_72(f) FIELD_RFL_FIELDS_71(f), f(p71)
+#define FIELD_RFL_FIELDS_73(f) FIELD_RFL_FIELDS_72(f), f(p72)
+#define FIELD_RFL_FIELDS_74(f) FIELD_RFL_FIELDS_73(f), f(p73)
+#define FIELD_RFL_FIELDS_75(f) FIELD_RFL_FIELDS_74(f), f(p74)
+#define FIELD_RFL_FIELDS_76(f) FIELD_RFL_FIELDS_75(f), f(p75)
+#define FIELD_RFL_FIELDS_77(f) FIELD_RFL_FIELDS_76(f), f(p76)
+#define FIELD_RFL_FIELDS_78(f) FIELD_RFL_FIELDS_77(f), f(p77)
+#define FIELD_RFL_FIELDS_79(f) FIELD_RFL_FIELDS_78(f), f(p78)
+#define FIELD_RFL_FIELDS_80(f) FIELD_RFL_FIELDS_79(f), f(p79)
+        TO_TUPLE_TEMPLATE(65)
+        TO_TUPLE_TEMPLATE(66)
+        TO_TUPLE_TEMPLATE(67)
+        TO_TUPLE_TEMPLATE(68)
+        TO_TUPLE_TEMPLATE(69)
+        TO_TUPLE_TEMPLATE(70)
+        TO_TUPLE_TEMPLATE(71)
+        TO_TUPLE_TEMPLATE(72)
+        TO_TUPLE_TEMPLATE(73)
+        TO_TUPLE_TEMPLATE(74)
+        TO_TUPLE_TEMPLATE(75)
+        TO_TUPLE_TEMPLATE(76)
+        TO_TUPLE_TEMPLATE(77)
+        TO_TUPLE_TEMPLATE(78)
+        TO_TUPLE_TEMPLATE(79)
+        TO_TUPLE_TEMPLATE(80)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 80
+#define FIELD_RFL_FIELDS_81(f) FIELD_RFL_FIELDS_80(f), f(p80)
+#define FIELD_RFL_FIELDS_82(f) FIELD_RFL_FIELDS_81(f), f(p81)
+#define FIELD_RFL_FIELDS_83(f) FIELD_RFL_FIELDS_82(f), f(p82)
+#define FIELD_RFL_FIELDS_84(f) FIELD_RFL_FIELDS_83(f), f(p83)
+#define FIELD_RFL_FIELDS_85(f) FIELD_RFL_FIELDS_84(f), f(p84)
+#define FIELD_RFL_FIELDS_86(f) FIELD_RFL_FIELDS_85(f), f(p85)
+#define FIELD_RFL_FIELDS_87(f) FIELD_RFL_FIELDS_86(f), f(p86)
+#define FIELD_RFL_FIELDS_88(f) FIELD_RFL_FIELDS_87(f), f(p87)
+#define FIELD_RFL_FIELDS_89(f) FIELD_RFL_FIELDS_88(f), f(p88)
+#define FIELD_RFL_FIELDS_90(f) FIELD_RFL_FIELDS_89(f), f(p89)
+#define FIELD_RFL_FIELDS_91(f) FIELD_RFL_FIELDS_90(f), f(p90)
+#define FIELD_RFL_FIELDS_92(f) FIELD_RFL_FIELDS_91(f), f(p91)
+#define FIELD_RFL_FIELDS_93(f) FIELD_RFL_FIELDS_92(f), f(p92)
+#define FIELD_RFL_FIELDS_94(f) FIELD_RFL_FIELDS_93(f), f(p93)
+#define FIELD_RFL_FIELDS_95(f) FIELD_RFL_FIELDS_94(f), f(p94)
+#define FIELD_RFL_FIELDS_96(f) FIELD_RFL_FIELDS_95(f), f(p95)
+        TO_TUPLE_TEMPLATE(81)
+        TO_TUPLE_TEMPLATE(82)
+        TO_TUPLE_TEMPLATE(83)
+        TO_TUPLE_TEMPLATE(84)
+        TO_TUPLE_TEMPLATE(85)
+        TO_TUPLE_TEMPLATE(86)
+        TO_TUPLE_TEMPLATE(87)
+        TO_TUPLE_TEMPLATE(88)
+        TO_TUPLE_TEMPLATE(89)
+        TO_TUPLE_TEMPLATE(90)
+        TO_TUPLE_TEMPLATE(91)
+        TO_TUPLE_TEMPLATE(92)
+        TO_TUPLE_TEMPLATE(93)
+        TO_TUPLE_TEMPLATE(94)
+        TO_TUPLE_TEMPLATE(95)
+        TO_TUPLE_TEMPLATE(96)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 96
+#define FIELD_RFL_FIELDS_97(f) FIELD_RFL_FIELDS_96(f), f(p96)
+#define FIELD_RFL_FIELDS_98(f) FIELD_RFL_FIELDS_97(f), f(p97)
+#define FIELD_RFL_FIELDS_99(f) FIELD_RFL_FIELDS_98(f), f(p98)
+#define FIELD_RFL_FIELDS_100(f) FIELD_RFL_FIELDS_99(f), f(p99)
+#define FIELD_RFL_FIELDS_101(f) FIELD_RFL_FIELDS_100(f), f(p100)
+#define FIELD_RFL_FIELDS_102(f) FIELD_RFL_FIELDS_101(f), f(p101)
+#define FIELD_RFL_FIELDS_103(f) FIELD_RFL_FIELDS_102(f), f(p102)
+#define FIELD_RFL_FIELDS_104(f) FIELD_RFL_FIELDS_103(f), f(p103)
+#define FIELD_RFL_FIELDS_105(f) FIELD_RFL_FIELDS_104(f), f(p104)
+#define FIELD_RFL_FIELDS_106(f) FIELD_RFL_FIELDS_105(f), f(p105)
+#define FIELD_RFL_FIELDS_107(f) FIELD_RFL_FIELDS_106(f), f(p106)
+#define FIELD_RFL_FIELDS_108(f) FIELD_RFL_FIELDS_107(f), f(p107)
+#define FIELD_RFL_FIELDS_109(f) FIELD_RFL_FIELDS_108(f), f(p108)
+#define FIELD_RFL_FIELDS_110(f) FIELD_RFL_FIELDS_109(f), f(p109)
+#define FIELD_RFL_FIELDS_111(f) FIELD_RFL_FIELDS_110(f), f(p110)
+#define FIELD_RFL_FIELDS_112(f) FIELD_RFL_FIELDS_111(f), f(p111)
+        TO_TUPLE_TEMPLATE(97)
+        TO_TUPLE_TEMPLATE(98)
+        TO_TUPLE_TEMPLATE(99)
+        TO_TUPLE_TEMPLATE(100)
+        TO_TUPLE_TEMPLATE(101)
+        TO_TUPLE_TEMPLATE(102)
+        TO_TUPLE_TEMPLATE(103)
+        TO_TUPLE_TEMPLATE(104)
+        TO_TUPLE_TEMPLATE(105)
+        TO_TUPLE_TEMPLATE(106)
+        TO_TUPLE_TEMPLATE(107)
+        TO_TUPLE_TEMPLATE(108)
+        TO_TUPLE_TEMPLATE(109)
+        TO_TUPLE_TEMPLATE(110)
+        TO_TUPLE_TEMPLATE(111)
+        TO_TUPLE_TEMPLATE(112)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 112
+#define FIELD_RFL_FIELDS_113(f) FIELD_RFL_FIELDS_112(f), f(p112)
+#define FIELD_RFL_FIELDS_114(f) FIELD_RFL_FIELDS_113(f), f(p113)
+#define FIELD_RFL_FIELDS_115(f) FIELD_RFL_FIELDS_114(f), f(p114)
+#define FIELD_RFL_FIELDS_116(f) FIELD_RFL_FIELDS_115(f), f(p115)
+#define FIELD_RFL_FIELDS_117(f) FIELD_RFL_FIELDS_116(f), f(p116)
+#define FIELD_RFL_FIELDS_118(f) FIELD_RFL_FIELDS_117(f), f(p117)
+#define FIELD_RFL_FIELDS_119(f) FIELD_RFL_FIELDS_118(f), f(p118)
+#define FIELD_RFL_FIELDS_120(f) FIELD_RFL_FIELDS_119(f), f(p119)
+#define FIELD_RFL_FIELDS_121(f) FIELD_RFL_FIELDS_120(f), f(p120)
+#define FIELD_RFL_FIELDS_122(f) FIELD_RFL_FIELDS_121(f), f(p121)
+#define FIELD_RFL_FIELDS_123(f) FIELD_RFL_FIELDS_122(f), f(p122)
+#define FIELD_RFL_FIELDS_124(f) FIELD_RFL_FIELDS_123(f), f(p123)
+#define FIELD_RFL_FIELDS_125(f) FIELD_RFL_FIELDS_124(f), f(p124)
+#define FIELD_RFL_FIELDS_126(f) FIELD_RFL_FIELDS_125(f), f(p125)
+#define FIELD_RFL_FIELDS_127(f) FIELD_RFL_FIELDS_126(f), f(p126)
+#define FIELD_RFL_FIELDS_128(f) FIELD_RFL_FIELDS_127(f), f(p127)
+        TO_TUPLE_TEMPLATE(113)
+        TO_TUPLE_TEMPLATE(114)
+        TO_TUPLE_TEMPLATE(115)
+        TO_TUPLE_TEMPLATE(116)
+        TO_TUPLE_TEMPLATE(117)
+        TO_TUPLE_TEMPLATE(118)
+        TO_TUPLE_TEMPLATE(119)
+        TO_TUPLE_TEMPLATE(120)
+        TO_TUPLE_TEMPLATE(121)
+        TO_TUPLE_TEMPLATE(122)
+        TO_TUPLE_TEMPLATE(123)
+        TO_TUPLE_TEMPLATE(124)
+        TO_TUPLE_TEMPLATE(125)
+        TO_TUPLE_TEMPLATE(126)
+        TO_TUPLE_TEMPLATE(127)
+        TO_TUPLE_TEMPLATE(128)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 128
+#define FIELD_RFL_FIELDS_129(f) FIELD_RFL_FIELDS_128(f), f(p128)
+#define FIELD_RFL_FIELDS_130(f) FIELD_RFL_FIELDS_129(f), f(p129)
+#define FIELD_RFL_FIELDS_131(f) FIELD_RFL_FIELDS_130(f), f(p130)
+#define FIELD_RFL_FIELDS_132(f) FIELD_RFL_FIELDS_131(f), f(p131)
+#define FIELD_RFL_FIELDS_133(f) FIELD_RFL_FIELDS_132(f), f(p132)
+#define FIELD_RFL_FIELDS_134(f) FIELD_RFL_FIELDS_133(f), f(p133)
+#define FIELD_RFL_FIELDS_135(f) FIELD_RFL_FIELDS_134(f), f(p134)
+#define FIELD_RFL_FIELDS_136(f) FIELD_RFL_FIELDS_135(f), f(p135)
+#define FIELD_RFL_FIELDS_137(f) FIELD_RFL_FIELDS_136(f), f(p136)
+#define FIELD_RFL_FIELDS_138(f) FIELD_RFL_FIELDS_137(f), f(p137)
+#define FIELD_RFL_FIELDS_139(f) FIELD_RFL_FIELDS_138(f), f(p138)
+#define FIELD_RFL_FIELDS_140(f) FIELD_RFL_FIELDS_139(f), f(p139)
+#define FIELD_RFL_FIELDS_141(f) FIELD_RFL_FIELDS_140(f), f(p140)
+#define FIELD_RFL_FIELDS_142(f) FIELD_RFL_FIELDS_141(f), f(p141)
+#define FIELD_RFL_FIELDS_143(f) FIELD_RFL_FIELDS_142(f), f(p142)
+#define FIELD_RFL_FIELDS_144(f) FIELD_RFL_FIELDS_143(f), f(p143)
+        TO_TUPLE_TEMPLATE(129)
+        TO_TUPLE_TEMPLATE(130)
+        TO_TUPLE_TEMPLATE(131)
+        TO_TUPLE_TEMPLATE(132)
+        TO_TUPLE_TEMPLATE(133)
+        TO_TUPLE_TEMPLATE(134)
+        TO_TUPLE_TEMPLATE(135)
+        TO_TUPLE_TEMPLATE(136)
+        TO_TUPLE_TEMPLATE(137)
+        TO_TUPLE_TEMPLATE(138)
+        TO_TUPLE_TEMPLATE(139)
+        TO_TUPLE_TEMPLATE(140)
+        TO_TUPLE_TEMPLATE(141)
+        TO_TUPLE_TEMPLATE(142)
+        TO_TUPLE_TEMPLATE(143)
+        TO_TUPLE_TEMPLATE(144)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 144
+#define FIELD_RFL_FIELDS_145(f) FIELD_RFL_FIELDS_144(f), f(p144)
+#define FIELD_RFL_FIELDS_146(f) FIELD_RFL_FIELDS_145(f), f(p145)
+#define FIELD_RFL_FIELDS_147(f) FIELD_RFL_FIELDS_146(f), f(p146)
+#define FIELD_RFL_FIELDS_148(f) FIELD_RFL_FIELDS_147(f), f(p147)
+#define FIELD_RFL_FIELDS_149(f) FIELD_RFL_FIELDS_148(f), f(p148)
+#define FIELD_RFL_FIELDS_150(f) FIELD_RFL_FIELDS_149(f), f(p149)
+#define FIELD_RFL_FIELDS_151(f) FIELD_RFL_FIELDS_150(f), f(p150)
+#define FIELD_RFL_FIELDS_152(f) FIELD_RFL_FIELDS_151(f), f(p151)
+#define FIELD_RFL_FIELDS_153(f) FIELD_RFL_FIELDS_152(f), f(p152)
+#define FIELD_RFL_FIELDS_154(f) FIELD_RFL_FIELDS_153(f), f(p153)
+#define FIELD_RFL_FIELDS_155(f) FIELD_RFL_FIELDS_154(f), f(p154)
+#define FIELD_RFL_FIELDS_156(f) FIELD_RFL_FIELDS_155(f), f(p155)
+#define FIELD_RFL_FIELDS_157(f) FIELD_RFL_FIELDS_156(f), f(p156)
+#define FIELD_RFL_FIELDS_158(f) FIELD_RFL_FIELDS_157(f), f(p157)
+#define FIELD_RFL_FIELDS_159(f) FIELD_RFL_FIELDS_158(f), f(p158)
+#define FIELD_RFL_FIELDS_160(f) FIELD_RFL_FIELDS_159(f), f(p159)
+        TO_TUPLE_TEMPLATE(145)
+        TO_TUPLE_TEMPLATE(146)
+        TO_TUPLE_TEMPLATE(147)
+        TO_TUPLE_TEMPLATE(148)
+        TO_TUPLE_TEMPLATE(149)
+        TO_TUPLE_TEMPLATE(150)
+        TO_TUPLE_TEMPLATE(151)
+        TO_TUPLE_TEMPLATE(152)
+        TO_TUPLE_TEMPLATE(153)
+        TO_TUPLE_TEMPLATE(154)
+        TO_TUPLE_TEMPLATE(155)
+        TO_TUPLE_TEMPLATE(156)
+        TO_TUPLE_TEMPLATE(157)
+        TO_TUPLE_TEMPLATE(158)
+        TO_TUPLE_TEMPLATE(159)
+        TO_TUPLE_TEMPLATE(160)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 160
+#define FIELD_RFL_FIELDS_161(f) FIELD_RFL_FIELDS_160(f), f(p160)
+#define FIELD_RFL_FIELDS_162(f) FIELD_RFL_FIELDS_161(f), f(p161)
+#define FIELD_RFL_FIELDS_163(f) FIELD_RFL_FIELDS_162(f), f(p162)
+#define FIELD_RFL_FIELDS_164(f) FIELD_RFL_FIELDS_163(f), f(p163)
+#define FIELD_RFL_FIELDS_165(f) FIELD_RFL_FIELDS_164(f), f(p164)
+#define FIELD_RFL_FIELDS_166(f) FIELD_RFL_FIELDS_165(f), f(p165)
+#define FIELD_RFL_FIELDS_167(f) FIELD_RFL_FIELDS_166(f), f(p166)
+#define FIELD_RFL_FIELDS_168(f) FIELD_RFL_FIELDS_167(f), f(p167)
+#define FIELD_RFL_FIELDS_169(f) FIELD_RFL_FIELDS_168(f), f(p168)
+#define FIELD_RFL_FIELDS_170(f) FIELD_RFL_FIELDS_169(f), f(p169)
+#define FIELD_RFL_FIELDS_171(f) FIELD_RFL_FIELDS_170(f), f(p170)
+#define FIELD_RFL_FIELDS_172(f) FIELD_RFL_FIELDS_171(f), f(p171)
+#define FIELD_RFL_FIELDS_173(f) FIELD_RFL_FIELDS_172(f), f(p172)
+#define FIELD_RFL_FIELDS_174(f) FIELD_RFL_FIELDS_173(f), f(p173)
+#define FIELD_RFL_FIELDS_175(f) FIELD_RFL_FIELDS_174(f), f(p174)
+#define FIELD_RFL_FIELDS_176(f) FIELD_RFL_FIELDS_175(f), f(p175)
+        TO_TUPLE_TEMPLATE(161)
+        TO_TUPLE_TEMPLATE(162)
+        TO_TUPLE_TEMPLATE(163)
+        TO_TUPLE_TEMPLATE(164)
+        TO_TUPLE_TEMPLATE(165)
+        TO_TUPLE_TEMPLATE(166)
+        TO_TUPLE_TEMPLATE(167)
+        TO_TUPLE_TEMPLATE(168)
+        TO_TUPLE_TEMPLATE(169)
+        TO_TUPLE_TEMPLATE(170)
+        TO_TUPLE_TEMPLATE(171)
+        TO_TUPLE_TEMPLATE(172)
+        TO_TUPLE_TEMPLATE(173)
+        TO_TUPLE_TEMPLATE(174)
+        TO_TUPLE_TEMPLATE(175)
+        TO_TUPLE_TEMPLATE(176)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 176
+#define FIELD_RFL_FIELDS_177(f) FIELD_RFL_FIELDS_176(f), f(p176)
+#define FIELD_RFL_FIELDS_178(f) FIELD_RFL_FIELDS_177(f), f(p177)
+#define FIELD_RFL_FIELDS_179(f) FIELD_RFL_FIELDS_178(f), f(p178)
+#define FIELD_RFL_FIELDS_180(f) FIELD_RFL_FIELDS_179(f), f(p179)
+#define FIELD_RFL_FIELDS_181(f) FIELD_RFL_FIELDS_180(f), f(p180)
+#define FIELD_RFL_FIELDS_182(f) FIELD_RFL_FIELDS_181(f), f(p181)
+#define FIELD_RFL_FIELDS_183(f) FIELD_RFL_FIELDS_182(f), f(p182)
+#define FIELD_RFL_FIELDS_184(f) FIELD_RFL_FIELDS_183(f), f(p183)
+#define FIELD_RFL_FIELDS_185(f) FIELD_RFL_FIELDS_184(f), f(p184)
+#define FIELD_RFL_FIELDS_186(f) FIELD_RFL_FIELDS_185(f), f(p185)
+#define FIELD_RFL_FIELDS_187(f) FIELD_RFL_FIELDS_186(f), f(p186)
+#define FIELD_RFL_FIELDS_188(f) FIELD_RFL_FIELDS_187(f), f(p187)
+#define FIELD_RFL_FIELDS_189(f) FIELD_RFL_FIELDS_188(f), f(p188)
+#define FIELD_RFL_FIELDS_190(f) FIELD_RFL_FIELDS_189(f), f(p189)
+#define FIELD_RFL_FIELDS_191(f) FIELD_RFL_FIELDS_190(f), f(p190)
+#define FIELD_RFL_FIELDS_192(f) FIELD_RFL_FIELDS_191(f), f(p191)
+        TO_TUPLE_TEMPLATE(177)
+        TO_TUPLE_TEMPLATE(178)
+        TO_TUPLE_TEMPLATE(179)
+        TO_TUPLE_TEMPLATE(180)
+        TO_TUPLE_TEMPLATE(181)
+        TO_TUPLE_TEMPLATE(182)
+        TO_TUPLE_TEMPLATE(183)
+        TO_TUPLE_TEMPLATE(184)
+        TO_TUPLE_TEMPLATE(185)
+        TO_TUPLE_TEMPLATE(186)
+        TO_TUPLE_TEMPLATE(187)
+        TO_TUPLE_TEMPLATE(188)
+        TO_TUPLE_TEMPLATE(189)
+        TO_TUPLE_TEMPLATE(190)
+        TO_TUPLE_TEMPLATE(191)
+        TO_TUPLE_TEMPLATE(192)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 192
+#define FIELD_RFL_FIELDS_193(f) FIELD_RFL_FIELDS_192(f), f(p192)
+#define FIELD_RFL_FIELDS_194(f) FIELD_RFL_FIELDS_193(f), f(p193)
+#define FIELD_RFL_FIELDS_195(f) FIELD_RFL_FIELDS_194(f), f(p194)
+#define FIELD_RFL_FIELDS_196(f) FIELD_RFL_FIELDS_195(f), f(p195)
+#define FIELD_RFL_FIELDS_197(f) FIELD_RFL_FIELDS_196(f), f(p196)
+#define FIELD_RFL_FIELDS_198(f) FIELD_RFL_FIELDS_197(f), f(p197)
+#define FIELD_RFL_FIELDS_199(f) FIELD_RFL_FIELDS_198(f), f(p198)
+#define FIELD_RFL_FIELDS_200(f) FIELD_RFL_FIELDS_199(f), f(p199)
+#define FIELD_RFL_FIELDS_201(f) FIELD_RFL_FIELDS_200(f), f(p200)
+#define FIELD_RFL_FIELDS_202(f) FIELD_RFL_FIELDS_201(f), f(p201)
+#define FIELD_RFL_FIELDS_203(f) FIELD_RFL_FIELDS_202(f), f(p202)
+#define FIELD_RFL_FIELDS_204(f) FIELD_RFL_FIELDS_203(f), f(p203)
+#define FIELD_RFL_FIELDS_205(f) FIELD_RFL_FIELDS_204(f), f(p204)
+#define FIELD_RFL_FIELDS_206(f) FIELD_RFL_FIELDS_205(f), f(p205)
+#define FIELD_RFL_FIELDS_207(f) FIELD_RFL_FIELDS_206(f), f(p206)
+#define FIELD_RFL_FIELDS_208(f) FIELD_RFL_FIELDS_207(f), f(p207)
+        TO_TUPLE_TEMPLATE(193)
+        TO_TUPLE_TEMPLATE(194)
+        TO_TUPLE_TEMPLATE(195)
+        TO_TUPLE_TEMPLATE(196)
+        TO_TUPLE_TEMPLATE(197)
+        TO_TUPLE_TEMPLATE(198)
+        TO_TUPLE_TEMPLATE(199)
+        TO_TUPLE_TEMPLATE(200)
+        TO_TUPLE_TEMPLATE(201)
+        TO_TUPLE_TEMPLATE(202)
+        TO_TUPLE_TEMPLATE(203)
+        TO_TUPLE_TEMPLATE(204)
+        TO_TUPLE_TEMPLATE(205)
+        TO_TUPLE_TEMPLATE(206)
+        TO_TUPLE_TEMPLATE(207)
+        TO_TUPLE_TEMPLATE(208)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 208
+#define FIELD_RFL_FIELDS_209(f) FIELD_RFL_FIELDS_208(f), f(p208)
+#define FIELD_RFL_FIELDS_210(f) FIELD_RFL_FIELDS_209(f), f(p209)
+#define FIELD_RFL_FIELDS_211(f) FIELD_RFL_FIELDS_210(f), f(p210)
+#define FIELD_RFL_FIELDS_212(f) FIELD_RFL_FIELDS_211(f), f(p211)
+#define FIELD_RFL_FIELDS_213(f) FIELD_RFL_FIELDS_212(f), f(p212)
+#define FIELD_RFL_FIELDS_214(f) FIELD_RFL_FIELDS_213(f), f(p213)
+#define FIELD_RFL_FIELDS_215(f) FIELD_RFL_FIELDS_214(f), f(p214)
+#define FIELD_RFL_FIELDS_216(f) FIELD_RFL_FIELDS_215(f), f(p215)
+#define FIELD_RFL_FIELDS_217(f) FIELD_RFL_FIELDS_216(f), f(p216)
+#define FIELD_RFL_FIELDS_218(f) FIELD_RFL_FIELDS_217(f), f(p217)
+#define FIELD_RFL_FIELDS_219(f) FIELD_RFL_FIELDS_218(f), f(p218)
+#define FIELD_RFL_FIELDS_220(f) FIELD_RFL_FIELDS_219(f), f(p219)
+#define FIELD_RFL_FIELDS_221(f) FIELD_RFL_FIELDS_220(f), f(p220)
+#define FIELD_RFL_FIELDS_222(f) FIELD_RFL_FIELDS_221(f), f(p221)
+#define FIELD_RFL_FIELDS_223(f) FIELD_RFL_FIELDS_222(f), f(p222)
+#define FIELD_RFL_FIELDS_224(f) FIELD_RFL_FIELDS_223(f), f(p223)
+        TO_TUPLE_TEMPLATE(209)
+        TO_TUPLE_TEMPLATE(210)
+        TO_TUPLE_TEMPLATE(211)
+        TO_TUPLE_TEMPLATE(212)
+        TO_TUPLE_TEMPLATE(213)
+        TO_TUPLE_TEMPLATE(214)
+        TO_TUPLE_TEMPLATE(215)
+        TO_TUPLE_TEMPLATE(216)
+        TO_TUPLE_TEMPLATE(217)
+        TO_TUPLE_TEMPLATE(218)
+        TO_TUPLE_TEMPLATE(219)
+        TO_TUPLE_TEMPLATE(220)
+        TO_TUPLE_TEMPLATE(221)
+        TO_TUPLE_TEMPLATE(222)
+        TO_TUPLE_TEMPLATE(223)
+        TO_TUPLE_TEMPLATE(224)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 224
+#define FIELD_RFL_FIELDS_225(f) FIELD_RFL_FIELDS_224(f), f(p224)
+#define FIELD_RFL_FIELDS_226(f) FIELD_RFL_FIELDS_225(f), f(p225)
+#define FIELD_RFL_FIELDS_227(f) FIELD_RFL_FIELDS_226(f), f(p226)
+#define FIELD_RFL_FIELDS_228(f) FIELD_RFL_FIELDS_227(f), f(p227)
+#define FIELD_RFL_FIELDS_229(f) FIELD_RFL_FIELDS_228(f), f(p228)
+#define FIELD_RFL_FIELDS_230(f) FIELD_RFL_FIELDS_229(f), f(p229)
+#define FIELD_RFL_FIELDS_231(f) FIELD_RFL_FIELDS_230(f), f(p230)
+#define FIELD_RFL_FIELDS_232(f) FIELD_RFL_FIELDS_231(f), f(p231)
+#define FIELD_RFL_FIELDS_233(f) FIELD_RFL_FIELDS_232(f), f(p232)
+#define FIELD_RFL_FIELDS_234(f) FIELD_RFL_FIELDS_233(f), f(p233)
+#define FIELD_RFL_FIELDS_235(f) FIELD_RFL_FIELDS_234(f), f(p234)
+#define FIELD_RFL_FIELDS_236(f) FIELD_RFL_FIELDS_235(f), f(p235)
+#define FIELD_RFL_FIELDS_237(f) FIELD_RFL_FIELDS_236(f), f(p236)
+#define FIELD_RFL_FIELDS_238(f) FIELD_RFL_FIELDS_237(f), f(p237)
+#define FIELD_RFL_FIELDS_239(f) FIELD_RFL_FIELDS_238(f), f(p238)
+#define FIELD_RFL_FIELDS_240(f) FIELD_RFL_FIELDS_239(f), f(p239)
+        TO_TUPLE_TEMPLATE(225)
+        TO_TUPLE_TEMPLATE(226)
+        TO_TUPLE_TEMPLATE(227)
+        TO_TUPLE_TEMPLATE(228)
+        TO_TUPLE_TEMPLATE(229)
+        TO_TUPLE_TEMPLATE(230)
+        TO_TUPLE_TEMPLATE(231)
+        TO_TUPLE_TEMPLATE(232)
+        TO_TUPLE_TEMPLATE(233)
+        TO_TUPLE_TEMPLATE(234)
+        TO_TUPLE_TEMPLATE(235)
+        TO_TUPLE_TEMPLATE(236)
+        TO_TUPLE_TEMPLATE(237)
+        TO_TUPLE_TEMPLATE(238)
+        TO_TUPLE_TEMPLATE(239)
+        TO_TUPLE_TEMPLATE(240)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 240
+#define FIELD_RFL_FIELDS_241(f) FIELD_RFL_FIELDS_240(f), f(p240)
+#define FIELD_RFL_FIELDS_242(f) FIELD_RFL_FIELDS_241(f), f(p241)
+#define FIELD_RFL_FIELDS_243(f) FIELD_RFL_FIELDS_242(f), f(p242)
+#define FIELD_RFL_FIELDS_244(f) FIELD_RFL_FIELDS_243(f), f(p243)
+#define FIELD_RFL_FIELDS_245(f) FIELD_RFL_FIELDS_244(f), f(p244)
+#define FIELD_RFL_FIELDS_246(f) FIELD_RFL_FIELDS_245(f), f(p245)
+#define FIELD_RFL_FIELDS_247(f) FIELD_RFL_FIELDS_246(f), f(p246)
+#define FIELD_RFL_FIELDS_248(f) FIELD_RFL_FIELDS_247(f), f(p247)
+#define FIELD_RFL_FIELDS_249(f) FIELD_RFL_FIELDS_248(f), f(p248)
+#define FIELD_RFL_FIELDS_250(f) FIELD_RFL_FIELDS_249(f), f(p249)
+#define FIELD_RFL_FIELDS_251(f) FIELD_RFL_FIELDS_250(f), f(p250)
+#define FIELD_RFL_FIELDS_252(f) FIELD_RFL_FIELDS_251(f), f(p251)
+#define FIELD_RFL_FIELDS_253(f) FIELD_RFL_FIELDS_252(f), f(p252)
+#define FIELD_RFL_FIELDS_254(f) FIELD_RFL_FIELDS_253(f), f(p253)
+#define FIELD_RFL_FIELDS_255(f) FIELD_RFL_FIELDS_254(f), f(p254)
+#define FIELD_RFL_FIELDS_256(f) FIELD_RFL_FIELDS_255(f), f(p255)
+        TO_TUPLE_TEMPLATE(241)
+        TO_TUPLE_TEMPLATE(242)
+        TO_TUPLE_TEMPLATE(243)
+        TO_TUPLE_TEMPLATE(244)
+        TO_TUPLE_TEMPLATE(245)
+        TO_TUPLE_TEMPLATE(246)
+        TO_TUPLE_TEMPLATE(247)
+        TO_TUPLE_TEMPLATE(248)
+        TO_TUPLE_TEMPLATE(249)
+        TO_TUPLE_TEMPLATE(250)
+        TO_TUPLE_TEMPLATE(251)
+        TO_TUPLE_TEMPLATE(252)
+        TO_TUPLE_TEMPLATE(253)
+        TO_TUPLE_TEMPLATE(254)
+        TO_TUPLE_TEMPLATE(255)
+        TO_TUPLE_TEMPLATE(256)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 256
+#define FIELD_RFL_FIELDS_257(f) FIELD_RFL_FIELDS_256(f), f(p256)
+#define FIELD_RFL_FIELDS_258(f) FIELD_RFL_FIELDS_257(f), f(p257)
+#define FIELD_RFL_FIELDS_259(f) FIELD_RFL_FIELDS_258(f), f(p258)
+#define FIELD_RFL_FIELDS_260(f) FIELD_RFL_FIELDS_259(f), f(p259)
+#define FIELD_RFL_FIELDS_261(f) FIELD_RFL_FIELDS_260(f), f(p260)
+#define FIELD_RFL_FIELDS_262(f) FIELD_RFL_FIELDS_261(f), f(p261)
+#define FIELD_RFL_FIELDS_263(f) FIELD_RFL_FIELDS_262(f), f(p262)
+#define FIELD_RFL_FIELDS_264(f) FIELD_RFL_FIELDS_263(f), f(p263)
+#define FIELD_RFL_FIELDS_265(f) FIELD_RFL_FIELDS_264(f), f(p264)
+#define FIELD_RFL_FIELDS_266(f) FIELD_RFL_FIELDS_265(f), f(p265)
+#define FIELD_RFL_FIELDS_267(f) FIELD_RFL_FIELDS_266(f), f(p266)
+#define FIELD_RFL_FIELDS_268(f) FIELD_RFL_FIELDS_267(f), f(p267)
+#define FIELD_RFL_FIELDS_269(f) FIELD_RFL_FIELDS_268(f), f(p268)
+#define FIELD_RFL_FIELDS_270(f) FIELD_RFL_FIELDS_269(f), f(p269)
+#define FIELD_RFL_FIELDS_271(f) FIELD_RFL_FIELDS_270(f), f(p270)
+#define FIELD_RFL_FIELDS_272(f) FIELD_RFL_FIELDS_271(f), f(p271)
+        TO_TUPLE_TEMPLATE(257)
+        TO_TUPLE_TEMPLATE(258)
+        TO_TUPLE_TEMPLATE(259)
+        TO_TUPLE_TEMPLATE(260)
+        TO_TUPLE_TEMPLATE(261)
+        TO_TUPLE_TEMPLATE(262)
+        TO_TUPLE_TEMPLATE(263)
+        TO_TUPLE_TEMPLATE(264)
+        TO_TUPLE_TEMPLATE(265)
+        TO_TUPLE_TEMPLATE(266)
+        TO_TUPLE_TEMPLATE(267)
+        TO_TUPLE_TEMPLATE(268)
+        TO_TUPLE_TEMPLATE(269)
+        TO_TUPLE_TEMPLATE(270)
+        TO_TUPLE_TEMPLATE(271)
+        TO_TUPLE_TEMPLATE(272)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 272
+#define FIELD_RFL_FIELDS_273(f) FIELD_RFL_FIELDS_272(f), f(p272)
+#define FIELD_RFL_FIELDS_274(f) FIELD_RFL_FIELDS_273(f), f(p273)
+#define FIELD_RFL_FIELDS_275(f) FIELD_RFL_FIELDS_274(f), f(p274)
+#define FIELD_RFL_FIELDS_276(f) FIELD_RFL_FIELDS_275(f), f(p275)
+#define FIELD_RFL_FIELDS_277(f) FIELD_RFL_FIELDS_276(f), f(p276)
+#define FIELD_RFL_FIELDS_278(f) FIELD_RFL_FIELDS_277(f), f(p277)
+#define FIELD_RFL_FIELDS_279(f) FIELD_RFL_FIELDS_278(f), f(p278)
+#define FIELD_RFL_FIELDS_280(f) FIELD_RFL_FIELDS_279(f), f(p279)
+#define FIELD_RFL_FIELDS_281(f) FIELD_RFL_FIELDS_280(f), f(p280)
+#define FIELD_RFL_FIELDS_282(f) FIELD_RFL_FIELDS_281(f), f(p281)
+#define FIELD_RFL_FIELDS_283(f) FIELD_RFL_FIELDS_282(f), f(p282)
+#define FIELD_RFL_FIELDS_284(f) FIELD_RFL_FIELDS_283(f), f(p283)
+#define FIELD_RFL_FIELDS_285(f) FIELD_RFL_FIELDS_284(f), f(p284)
+#define FIELD_RFL_FIELDS_286(f) FIELD_RFL_FIELDS_285(f), f(p285)
+#define FIELD_RFL_FIELDS_287(f) FIELD_RFL_FIELDS_286(f), f(p286)
+#define FIELD_RFL_FIELDS_288(f) FIELD_RFL_FIELDS_287(f), f(p287)
+        TO_TUPLE_TEMPLATE(273)
+        TO_TUPLE_TEMPLATE(274)
+        TO_TUPLE_TEMPLATE(275)
+        TO_TUPLE_TEMPLATE(276)
+        TO_TUPLE_TEMPLATE(277)
+        TO_TUPLE_TEMPLATE(278)
+        TO_TUPLE_TEMPLATE(279)
+        TO_TUPLE_TEMPLATE(280)
+        TO_TUPLE_TEMPLATE(281)
+        TO_TUPLE_TEMPLATE(282)
+        TO_TUPLE_TEMPLATE(283)
+        TO_TUPLE_TEMPLATE(284)
+        TO_TUPLE_TEMPLATE(285)
+        TO_TUPLE_TEMPLATE(286)
+        TO_TUPLE_TEMPLATE(287)
+        TO_TUPLE_TEMPLATE(288)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 288
+#define FIELD_RFL_FIELDS_289(f) FIELD_RFL_FIELDS_288(f), f(p288)
+#define FIELD_RFL_FIELDS_290(f) FIELD_RFL_FIELDS_289(f), f(p289)
+#define FIELD_RFL_FIELDS_291(f) FIELD_RFL_FIELDS_290(f), f(p290)
+#define FIELD_RFL_FIELDS_292(f) FIELD_RFL_FIELDS_291(f), f(p291)
+#define FIELD_RFL_FIELDS_293(f) FIELD_RFL_FIELDS_292(f), f(p292)
+#define FIELD_RFL_FIELDS_294(f) FIELD_RFL_FIELDS_293(f), f(p293)
+#define FIELD_RFL_FIELDS_295(f) FIELD_RFL_FIELDS_294(f), f(p294)
+#define FIELD_RFL_FIELDS_296(f) FIELD_RFL_FIELDS_295(f), f(p295)
+#define FIELD_RFL_FIELDS_297(f) FIELD_RFL_FIELDS_296(f), f(p296)
+#define FIELD_RFL_FIELDS_298(f) FIELD_RFL_FIELDS_297(f), f(p297)
+#define FIELD_RFL_FIELDS_299(f) FIELD_RFL_FIELDS_298(f), f(p298)
+#define FIELD_RFL_FIELDS_300(f) FIELD_RFL_FIELDS_299(f), f(p299)
+#define FIELD_RFL_FIELDS_301(f) FIELD_RFL_FIELDS_300(f), f(p300)
+#define FIELD_RFL_FIELDS_302(f) FIELD_RFL_FIELDS_301(f), f(p301)
+#define FIELD_RFL_FIELDS_303(f) FIELD_RFL_FIELDS_302(f), f(p302)
+#define FIELD_RFL_FIELDS_304(f) FIELD_RFL_FIELDS_303(f), f(p303)
+        TO_TUPLE_TEMPLATE(289)
+        TO_TUPLE_TEMPLATE(290)
+        TO_TUPLE_TEMPLATE(291)
+        TO_TUPLE_TEMPLATE(292)
+        TO_TUPLE_TEMPLATE(293)
+        TO_TUPLE_TEMPLATE(294)
+        TO_TUPLE_TEMPLATE(295)
+        TO_TUPLE_TEMPLATE(296)
+        TO_TUPLE_TEMPLATE(297)
+        TO_TUPLE_TEMPLATE(298)
+        TO_TUPLE_TEMPLATE(299)
+        TO_TUPLE_TEMPLATE(300)
+        TO_TUPLE_TEMPLATE(301)
+        TO_TUPLE_TEMPLATE(302)
+        TO_TUPLE_TEMPLATE(303)
+        TO_TUPLE_TEMPLATE(304)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 304
+#define FIELD_RFL_FIELDS_305(f) FIELD_RFL_FIELDS_304(f), f(p304)
+#define FIELD_RFL_FIELDS_306(f) FIELD_RFL_FIELDS_305(f), f(p305)
+#define FIELD_RFL_FIELDS_307(f) FIELD_RFL_FIELDS_306(f), f(p306)
+#define FIELD_RFL_FIELDS_308(f) FIELD_RFL_FIELDS_307(f), f(p307)
+#define FIELD_RFL_FIELDS_309(f) FIELD_RFL_FIELDS_308(f), f(p308)
+#define FIELD_RFL_FIELDS_310(f) FIELD_RFL_FIELDS_309(f), f(p309)
+#define FIELD_RFL_FIELDS_311(f) FIELD_RFL_FIELDS_310(f), f(p310)
+#define FIELD_RFL_FIELDS_312(f) FIELD_RFL_FIELDS_311(f), f(p311)
+#define FIELD_RFL_FIELDS_313(f) FIELD_RFL_FIELDS_312(f), f(p312)
+#define FIELD_RFL_FIELDS_314(f) FIELD_RFL_FIELDS_313(f), f(p313)
+#define FIELD_RFL_FIELDS_315(f) FIELD_RFL_FIELDS_314(f), f(p314)
+#define FIELD_RFL_FIELDS_316(f) FIELD_RFL_FIELDS_315(f), f(p315)
+#define FIELD_RFL_FIELDS_317(f) FIELD_RFL_FIELDS_316(f), f(p316)
+#define FIELD_RFL_FIELDS_318(f) FIELD_RFL_FIELDS_317(f), f(p317)
+#define FIELD_RFL_FIELDS_319(f) FIELD_RFL_FIELDS_318(f), f(p318)
+#define FIELD_RFL_FIELDS_320(f) FIELD_RFL_FIELDS_319(f), f(p319)
+        TO_TUPLE_TEMPLATE(305)
+        TO_TUPLE_TEMPLATE(306)
+        TO_TUPLE_TEMPLATE(307)
+        TO_TUPLE_TEMPLATE(308)
+        TO_TUPLE_TEMPLATE(309)
+        TO_TUPLE_TEMPLATE(310)
+        TO_TUPLE_TEMPLATE(311)
+        TO_TUPLE_TEMPLATE(312)
+        TO_TUPLE_TEMPLATE(313)
+        TO_TUPLE_TEMPLATE(314)
+        TO_TUPLE_TEMPLATE(315)
+        TO_TUPLE_TEMPLATE(316)
+        TO_TUPLE_TEMPLATE(317)
+        TO_TUPLE_TEMPLATE(318)
+        TO_TUPLE_TEMPLATE(319)
+        TO_TUPLE_TEMPLATE(320)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 320
+#define FIELD_RFL_FIELDS_321(f) FIELD_RFL_FIELDS_320(f), f(p320)
+#define FIELD_RFL_FIELDS_322(f) FIELD_RFL_FIELDS_321(f), f(p321)
+#define FIELD_RFL_FIELDS_323(f) FIELD_RFL_FIELDS_322(f), f(p322)
+#define FIELD_RFL_FIELDS_324(f) FIELD_RFL_FIELDS_323(f), f(p323)
+#define FIELD_RFL_FIELDS_325(f) FIELD_RFL_FIELDS_324(f), f(p324)
+#define FIELD_RFL_FIELDS_326(f) FIELD_RFL_FIELDS_325(f), f(p325)
+#define FIELD_RFL_FIELDS_327(f) FIELD_RFL_FIELDS_326(f), f(p326)
+#define FIELD_RFL_FIELDS_328(f) FIELD_RFL_FIELDS_327(f), f(p327)
+#define FIELD_RFL_FIELDS_329(f) FIELD_RFL_FIELDS_328(f), f(p328)
+#define FIELD_RFL_FIELDS_330(f) FIELD_RFL_FIELDS_329(f), f(p329)
+#define FIELD_RFL_FIELDS_331(f) FIELD_RFL_FIELDS_330(f), f(p330)
+#define FIELD_RFL_FIELDS_332(f) FIELD_RFL_FIELDS_331(f), f(p331)
+#define FIELD_RFL_FIELDS_333(f) FIELD_RFL_FIELDS_332(f), f(p332)
+#define FIELD_RFL_FIELDS_334(f) FIELD_RFL_FIELDS_333(f), f(p333)
+#define FIELD_RFL_FIELDS_335(f) FIELD_RFL_FIELDS_334(f), f(p334)
+#define FIELD_RFL_FIELDS_336(f) FIELD_RFL_FIELDS_335(f), f(p335)
+        TO_TUPLE_TEMPLATE(321)
+        TO_TUPLE_TEMPLATE(322)
+        TO_TUPLE_TEMPLATE(323)
+        TO_TUPLE_TEMPLATE(324)
+        TO_TUPLE_TEMPLATE(325)
+        TO_TUPLE_TEMPLATE(326)
+        TO_TUPLE_TEMPLATE(327)
+        TO_TUPLE_TEMPLATE(328)
+        TO_TUPLE_TEMPLATE(329)
+        TO_TUPLE_TEMPLATE(330)
+        TO_TUPLE_TEMPLATE(331)
+        TO_TUPLE_TEMPLATE(332)
+        TO_TUPLE_TEMPLATE(333)
+        TO_TUPLE_TEMPLATE(334)
+        TO_TUPLE_TEMPLATE(335)
+        TO_TUPLE_TEMPLATE(336)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 336
+#define FIELD_RFL_FIELDS_337(f) FIELD_RFL_FIELDS_336(f), f(p336)
+#define FIELD_RFL_FIELDS_338(f) FIELD_RFL_FIELDS_337(f), f(p337)
+#define FIELD_RFL_FIELDS_339(f) FIELD_RFL_FIELDS_338(f), f(p338)
+#define FIELD_RFL_FIELDS_340(f) FIELD_RFL_FIELDS_339(f), f(p339)
+#define FIELD_RFL_FIELDS_341(f) FIELD_RFL_FIELDS_340(f), f(p340)
+#define FIELD_RFL_FIELDS_342(f) FIELD_RFL_FIELDS_341(f), f(p341)
+#define FIELD_RFL_FIELDS_343(f) FIELD_RFL_FIELDS_342(f), f(p342)
+#define FIELD_RFL_FIELDS_344(f) FIELD_RFL_FIELDS_343(f), f(p343)
+#define FIELD_RFL_FIELDS_345(f) FIELD_RFL_FIELDS_344(f), f(p344)
+#define FIELD_RFL_FIELDS_346(f) FIELD_RFL_FIELDS_345(f), f(p345)
+#define FIELD_RFL_FIELDS_347(f) FIELD_RFL_FIELDS_346(f), f(p346)
+#define FIELD_RFL_FIELDS_348(f) FIELD_RFL_FIELDS_347(f), f(p347)
+#define FIELD_RFL_FIELDS_349(f) FIELD_RFL_FIELDS_348(f), f(p348)
+#define FIELD_RFL_FIELDS_350(f) FIELD_RFL_FIELDS_349(f), f(p349)
+#define FIELD_RFL_FIELDS_351(f) FIELD_RFL_FIELDS_350(f), f(p350)
+#define FIELD_RFL_FIELDS_352(f) FIELD_RFL_FIELDS_351(f), f(p351)
+        TO_TUPLE_TEMPLATE(337)
+        TO_TUPLE_TEMPLATE(338)
+        TO_TUPLE_TEMPLATE(339)
+        TO_TUPLE_TEMPLATE(340)
+        TO_TUPLE_TEMPLATE(341)
+        TO_TUPLE_TEMPLATE(342)
+        TO_TUPLE_TEMPLATE(343)
+        TO_TUPLE_TEMPLATE(344)
+        TO_TUPLE_TEMPLATE(345)
+        TO_TUPLE_TEMPLATE(346)
+        TO_TUPLE_TEMPLATE(347)
+        TO_TUPLE_TEMPLATE(348)
+        TO_TUPLE_TEMPLATE(349)
+        TO_TUPLE_TEMPLATE(350)
+        TO_TUPLE_TEMPLATE(351)
+        TO_TUPLE_TEMPLATE(352)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 352
+#define FIELD_RFL_FIELDS_353(f) FIELD_RFL_FIELDS_352(f), f(p352)
+#define FIELD_RFL_FIELDS_354(f) FIELD_RFL_FIELDS_353(f), f(p353)
+#define FIELD_RFL_FIELDS_355(f) FIELD_RFL_FIELDS_354(f), f(p354)
+#define FIELD_RFL_FIELDS_356(f) FIELD_RFL_FIELDS_355(f), f(p355)
+#define FIELD_RFL_FIELDS_357(f) FIELD_RFL_FIELDS_356(f), f(p356)
+#define FIELD_RFL_FIELDS_358(f) FIELD_RFL_FIELDS_357(f), f(p357)
+#define FIELD_RFL_FIELDS_359(f) FIELD_RFL_FIELDS_358(f), f(p358)
+#define FIELD_RFL_FIELDS_360(f) FIELD_RFL_FIELDS_359(f), f(p359)
+#define FIELD_RFL_FIELDS_361(f) FIELD_RFL_FIELDS_360(f), f(p360)
+#define FIELD_RFL_FIELDS_362(f) FIELD_RFL_FIELDS_361(f), f(p361)
+#define FIELD_RFL_FIELDS_363(f) FIELD_RFL_FIELDS_362(f), f(p362)
+#define FIELD_RFL_FIELDS_364(f) FIELD_RFL_FIELDS_363(f), f(p363)
+#define FIELD_RFL_FIELDS_365(f) FIELD_RFL_FIELDS_364(f), f(p364)
+#define FIELD_RFL_FIELDS_366(f) FIELD_RFL_FIELDS_365(f), f(p365)
+#define FIELD_RFL_FIELDS_367(f) FIELD_RFL_FIELDS_366(f), f(p366)
+#define FIELD_RFL_FIELDS_368(f) FIELD_RFL_FIELDS_367(f), f(p367)
+        TO_TUPLE_TEMPLATE(353)
+        TO_TUPLE_TEMPLATE(354)
+        TO_TUPLE_TEMPLATE(355)
+        TO_TUPLE_TEMPLATE(356)
+        TO_TUPLE_TEMPLATE(357)
+        TO_TUPLE_TEMPLATE(358)
+        TO_TUPLE_TEMPLATE(359)
+        TO_TUPLE_TEMPLATE(360)
+        TO_TUPLE_TEMPLATE(361)
+        TO_TUPLE_TEMPLATE(362)
+        TO_TUPLE_TEMPLATE(363)
+        TO_TUPLE_TEMPLATE(364)
+        TO_TUPLE_TEMPLATE(365)
+        TO_TUPLE_TEMPLATE(366)
+        TO_TUPLE_TEMPLATE(367)
+        TO_TUPLE_TEMPLATE(368)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 368
+#define FIELD_RFL_FIELDS_369(f) FIELD_RFL_FIELDS_368(f), f(p368)
+#define FIELD_RFL_FIELDS_370(f) FIELD_RFL_FIELDS_369(f), f(p369)
+#define FIELD_RFL_FIELDS_371(f) FIELD_RFL_FIELDS_370(f), f(p370)
+#define FIELD_RFL_FIELDS_372(f) FIELD_RFL_FIELDS_371(f), f(p371)
+#define FIELD_RFL_FIELDS_373(f) FIELD_RFL_FIELDS_372(f), f(p372)
+#define FIELD_RFL_FIELDS_374(f) FIELD_RFL_FIELDS_373(f), f(p373)
+#define FIELD_RFL_FIELDS_375(f) FIELD_RFL_FIELDS_374(f), f(p374)
+#define FIELD_RFL_FIELDS_376(f) FIELD_RFL_FIELDS_375(f), f(p375)
+#define FIELD_RFL_FIELDS_377(f) FIELD_RFL_FIELDS_376(f), f(p376)
+#define FIELD_RFL_FIELDS_378(f) FIELD_RFL_FIELDS_377(f), f(p377)
+#define FIELD_RFL_FIELDS_379(f) FIELD_RFL_FIELDS_378(f), f(p378)
+#define FIELD_RFL_FIELDS_380(f) FIELD_RFL_FIELDS_379(f), f(p379)
+#define FIELD_RFL_FIELDS_381(f) FIELD_RFL_FIELDS_380(f), f(p380)
+#define FIELD_RFL_FIELDS_382(f) FIELD_RFL_FIELDS_381(f), f(p381)
+#define FIELD_RFL_FIELDS_383(f) FIELD_RFL_FIELDS_382(f), f(p382)
+#define FIELD_RFL_FIELDS_384(f) FIELD_RFL_FIELDS_383(f), f(p383)
+        TO_TUPLE_TEMPLATE(369)
+        TO_TUPLE_TEMPLATE(370)
+        TO_TUPLE_TEMPLATE(371)
+        TO_TUPLE_TEMPLATE(372)
+        TO_TUPLE_TEMPLATE(373)
+        TO_TUPLE_TEMPLATE(374)
+        TO_TUPLE_TEMPLATE(375)
+        TO_TUPLE_TEMPLATE(376)
+        TO_TUPLE_TEMPLATE(377)
+        TO_TUPLE_TEMPLATE(378)
+        TO_TUPLE_TEMPLATE(379)
+        TO_TUPLE_TEMPLATE(380)
+        TO_TUPLE_TEMPLATE(381)
+        TO_TUPLE_TEMPLATE(382)
+        TO_TUPLE_TEMPLATE(383)
+        TO_TUPLE_TEMPLATE(384)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 384
+#define FIELD_RFL_FIELDS_385(f) FIELD_RFL_FIELDS_384(f), f(p384)
+#define FIELD_RFL_FIELDS_386(f) FIELD_RFL_FIELDS_385(f), f(p385)
+#define FIELD_RFL_FIELDS_387(f) FIELD_RFL_FIELDS_386(f), f(p386)
+#define FIELD_RFL_FIELDS_388(f) FIELD_RFL_FIELDS_387(f), f(p387)
+#define FIELD_RFL_FIELDS_389(f) FIELD_RFL_FIELDS_388(f), f(p388)
+#define FIELD_RFL_FIELDS_390(f) FIELD_RFL_FIELDS_389(f), f(p389)
+#define FIELD_RFL_FIELDS_391(f) FIELD_RFL_FIELDS_390(f), f(p390)
+#define FIELD_RFL_FIELDS_392(f) FIELD_RFL_FIELDS_391(f), f(p391)
+#define FIELD_RFL_FIELDS_393(f) FIELD_RFL_FIELDS_392(f), f(p392)
+#define FIELD_RFL_FIELDS_394(f) FIELD_RFL_FIELDS_393(f), f(p393)
+#define FIELD_RFL_FIELDS_395(f) FIELD_RFL_FIELDS_394(f), f(p394)
+#define FIELD_RFL_FIELDS_396(f) FIELD_RFL_FIELDS_395(f), f(p395)
+#define FIELD_RFL_FIELDS_397(f) FIELD_RFL_FIELDS_396(f), f(p396)
+#define FIELD_RFL_FIELDS_398(f) FIELD_RFL_FIELDS_397(f), f(p397)
+#define FIELD_RFL_FIELDS_399(f) FIELD_RFL_FIELDS_398(f), f(p398)
+#define FIELD_RFL_FIELDS_400(f) FIELD_RFL_FIELDS_399(f), f(p399)
+        TO_TUPLE_TEMPLATE(385)
+        TO_TUPLE_TEMPLATE(386)
+        TO_TUPLE_TEMPLATE(387)
+        TO_TUPLE_TEMPLATE(388)
+        TO_TUPLE_TEMPLATE(389)
+        TO_TUPLE_TEMPLATE(390)
+        TO_TUPLE_TEMPLATE(391)
+        TO_TUPLE_TEMPLATE(392)
+        TO_TUPLE_TEMPLATE(393)
+        TO_TUPLE_TEMPLATE(394)
+        TO_TUPLE_TEMPLATE(395)
+        TO_TUPLE_TEMPLATE(396)
+        TO_TUPLE_TEMPLATE(397)
+        TO_TUPLE_TEMPLATE(398)
+        TO_TUPLE_TEMPLATE(399)
+        TO_TUPLE_TEMPLATE(400)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 400
+#define FIELD_RFL_FIELDS_401(f) FIELD_RFL_FIELDS_400(f), f(p400)
+#define FIELD_RFL_FIELDS_402(f) FIELD_RFL_FIELDS_401(f), f(p401)
+#define FIELD_RFL_FIELDS_403(f) FIELD_RFL_FIELDS_402(f), f(p402)
+#define FIELD_RFL_FIELDS_404(f) FIELD_RFL_FIELDS_403(f), f(p403)
+#define FIELD_RFL_FIELDS_405(f) FIELD_RFL_FIELDS_404(f), f(p404)
+#define FIELD_RFL_FIELDS_406(f) FIELD_RFL_FIELDS_405(f), f(p405)
+#define FIELD_RFL_FIELDS_407(f) FIELD_RFL_FIELDS_406(f), f(p406)
+#define FIELD_RFL_FIELDS_408(f) FIELD_RFL_FIELDS_407(f), f(p407)
+#define FIELD_RFL_FIELDS_409(f) FIELD_RFL_FIELDS_408(f), f(p408)
+#define FIELD_RFL_FIELDS_410(f) FIELD_RFL_FIELDS_409(f), f(p409)
+#define FIELD_RFL_FIELDS_411(f) FIELD_RFL_FIELDS_410(f), f(p410)
+#define FIELD_RFL_FIELDS_412(f) FIELD_RFL_FIELDS_411(f), f(p411)
+#define FIELD_RFL_FIELDS_413(f) FIELD_RFL_FIELDS_412(f), f(p412)
+#define FIELD_RFL_FIELDS_414(f) FIELD_RFL_FIELDS_413(f), f(p413)
+#define FIELD_RFL_FIELDS_415(f) FIELD_RFL_FIELDS_414(f), f(p414)
+#define FIELD_RFL_FIELDS_416(f) FIELD_RFL_FIELDS_415(f), f(p415)
+        TO_TUPLE_TEMPLATE(401)
+        TO_TUPLE_TEMPLATE(402)
+        TO_TUPLE_TEMPLATE(403)
+        TO_TUPLE_TEMPLATE(404)
+        TO_TUPLE_TEMPLATE(405)
+        TO_TUPLE_TEMPLATE(406)
+        TO_TUPLE_TEMPLATE(407)
+        TO_TUPLE_TEMPLATE(408)
+        TO_TUPLE_TEMPLATE(409)
+        TO_TUPLE_TEMPLATE(410)
+        TO_TUPLE_TEMPLATE(411)
+        TO_TUPLE_TEMPLATE(412)
+        TO_TUPLE_TEMPLATE(413)
+        TO_TUPLE_TEMPLATE(414)
+        TO_TUPLE_TEMPLATE(415)
+        TO_TUPLE_TEMPLATE(416)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 416
+#define FIELD_RFL_FIELDS_417(f) FIELD_RFL_FIELDS_416(f), f(p416)
+#define FIELD_RFL_FIELDS_418(f) FIELD_RFL_FIELDS_417(f), f(p417)
+#define FIELD_RFL_FIELDS_419(f) FIELD_RFL_FIELDS_418(f), f(p418)
+#define FIELD_RFL_FIELDS_420(f) FIELD_RFL_FIELDS_419(f), f(p419)
+#define FIELD_RFL_FIELDS_421(f) FIELD_RFL_FIELDS_420(f), f(p420)
+#define FIELD_RFL_FIELDS_422(f) FIELD_RFL_FIELDS_421(f), f(p421)
+#define FIELD_RFL_FIELDS_423(f) FIELD_RFL_FIELDS_422(f), f(p422)
+#define FIELD_RFL_FIELDS_424(f) FIELD_RFL_FIELDS_423(f), f(p423)
+#define FIELD_RFL_FIELDS_425(f) FIELD_RFL_FIELDS_424(f), f(p424)
+#define FIELD_RFL_FIELDS_426(f) FIELD_RFL_FIELDS_425(f), f(p425)
+#define FIELD_RFL_FIELDS_427(f) FIELD_RFL_FIELDS_426(f), f(p426)
+#define FIELD_RFL_FIELDS_428(f) FIELD_RFL_FIELDS_427(f), f(p427)
+#define FIELD_RFL_FIELDS_429(f) FIELD_RFL_FIELDS_428(f), f(p428)
+#define FIELD_RFL_FIELDS_430(f) FIELD_RFL_FIELDS_429(f), f(p429)
+#define FIELD_RFL_FIELDS_431(f) FIELD_RFL_FIELDS_430(f), f(p430)
+#define FIELD_RFL_FIELDS_432(f) FIELD_RFL_FIELDS_431(f), f(p431)
+        TO_TUPLE_TEMPLATE(417)
+        TO_TUPLE_TEMPLATE(418)
+        TO_TUPLE_TEMPLATE(419)
+        TO_TUPLE_TEMPLATE(420)
+        TO_TUPLE_TEMPLATE(421)
+        TO_TUPLE_TEMPLATE(422)
+        TO_TUPLE_TEMPLATE(423)
+        TO_TUPLE_TEMPLATE(424)
+        TO_TUPLE_TEMPLATE(425)
+        TO_TUPLE_TEMPLATE(426)
+        TO_TUPLE_TEMPLATE(427)
+        TO_TUPLE_TEMPLATE(428)
+        TO_TUPLE_TEMPLATE(429)
+        TO_TUPLE_TEMPLATE(430)
+        TO_TUPLE_TEMPLATE(431)
+        TO_TUPLE_TEMPLATE(432)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 432
+#define FIELD_RFL_FIELDS_433(f) FIELD_RFL_FIELDS_432(f), f(p432)
+#define FIELD_RFL_FIELDS_434(f) FIELD_RFL_FIELDS_433(f), f(p433)
+#define FIELD_RFL_FIELDS_435(f) FIELD_RFL_FIELDS_434(f), f(p434)
+#define FIELD_RFL_FIELDS_436(f) FIELD_RFL_FIELDS_435(f), f(p435)
+#define FIELD_RFL_FIELDS_437(f) FIELD_RFL_FIELDS_436(f), f(p436)
+#define FIELD_RFL_FIELDS_438(f) FIELD_RFL_FIELDS_437(f), f(p437)
+#define FIELD_RFL_FIELDS_439(f) FIELD_RFL_FIELDS_438(f), f(p438)
+#define FIELD_RFL_FIELDS_440(f) FIELD_RFL_FIELDS_439(f), f(p439)
+#define FIELD_RFL_FIELDS_441(f) FIELD_RFL_FIELDS_440(f), f(p440)
+#define FIELD_RFL_FIELDS_442(f) FIELD_RFL_FIELDS_441(f), f(p441)
+#define FIELD_RFL_FIELDS_443(f) FIELD_RFL_FIELDS_442(f), f(p442)
+#define FIELD_RFL_FIELDS_444(f) FIELD_RFL_FIELDS_443(f), f(p443)
+#define FIELD_RFL_FIELDS_445(f) FIELD_RFL_FIELDS_444(f), f(p444)
+#define FIELD_RFL_FIELDS_446(f) FIELD_RFL_FIELDS_445(f), f(p445)
+#define FIELD_RFL_FIELDS_447(f) FIELD_RFL_FIELDS_446(f), f(p446)
+#define FIELD_RFL_FIELDS_448(f) FIELD_RFL_FIELDS_447(f), f(p447)
+        TO_TUPLE_TEMPLATE(433)
+        TO_TUPLE_TEMPLATE(434)
+        TO_TUPLE_TEMPLATE(435)
+        TO_TUPLE_TEMPLATE(436)
+        TO_TUPLE_TEMPLATE(437)
+        TO_TUPLE_TEMPLATE(438)
+        TO_TUPLE_TEMPLATE(439)
+        TO_TUPLE_TEMPLATE(440)
+        TO_TUPLE_TEMPLATE(441)
+        TO_TUPLE_TEMPLATE(442)
+        TO_TUPLE_TEMPLATE(443)
+        TO_TUPLE_TEMPLATE(444)
+        TO_TUPLE_TEMPLATE(445)
+        TO_TUPLE_TEMPLATE(446)
+        TO_TUPLE_TEMPLATE(447)
+        TO_TUPLE_TEMPLATE(448)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 448
+#define FIELD_RFL_FIELDS_449(f) FIELD_RFL_FIELDS_448(f), f(p448)
+#define FIELD_RFL_FIELDS_450(f) FIELD_RFL_FIELDS_449(f), f(p449)
+#define FIELD_RFL_FIELDS_451(f) FIELD_RFL_FIELDS_450(f), f(p450)
+#define FIELD_RFL_FIELDS_452(f) FIELD_RFL_FIELDS_451(f), f(p451)
+#define FIELD_RFL_FIELDS_453(f) FIELD_RFL_FIELDS_452(f), f(p452)
+#define FIELD_RFL_FIELDS_454(f) FIELD_RFL_FIELDS_453(f), f(p453)
+#define FIELD_RFL_FIELDS_455(f) FIELD_RFL_FIELDS_454(f), f(p454)
+#define FIELD_RFL_FIELDS_456(f) FIELD_RFL_FIELDS_455(f), f(p455)
+#define FIELD_RFL_FIELDS_457(f) FIELD_RFL_FIELDS_456(f), f(p456)
+#define FIELD_RFL_FIELDS_458(f) FIELD_RFL_FIELDS_457(f), f(p457)
+#define FIELD_RFL_FIELDS_459(f) FIELD_RFL_FIELDS_458(f), f(p458)
+#define FIELD_RFL_FIELDS_460(f) FIELD_RFL_FIELDS_459(f), f(p459)
+#define FIELD_RFL_FIELDS_461(f) FIELD_RFL_FIELDS_460(f), f(p460)
+#define FIELD_RFL_FIELDS_462(f) FIELD_RFL_FIELDS_461(f), f(p461)
+#define FIELD_RFL_FIELDS_463(f) FIELD_RFL_FIELDS_462(f), f(p462)
+#define FIELD_RFL_FIELDS_464(f) FIELD_RFL_FIELDS_463(f), f(p463)
+        TO_TUPLE_TEMPLATE(449)
+        TO_TUPLE_TEMPLATE(450)
+        TO_TUPLE_TEMPLATE(451)
+        TO_TUPLE_TEMPLATE(452)
+        TO_TUPLE_TEMPLATE(453)
+        TO_TUPLE_TEMPLATE(454)
+        TO_TUPLE_TEMPLATE(455)
+        TO_TUPLE_TEMPLATE(456)
+        TO_TUPLE_TEMPLATE(457)
+        TO_TUPLE_TEMPLATE(458)
+        TO_TUPLE_TEMPLATE(459)
+        TO_TUPLE_TEMPLATE(460)
+        TO_TUPLE_TEMPLATE(461)
+        TO_TUPLE_TEMPLATE(462)
+        TO_TUPLE_TEMPLATE(463)
+        TO_TUPLE_TEMPLATE(464)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 464
+#define FIELD_RFL_FIELDS_465(f) FIELD_RFL_FIELDS_464(f), f(p464)
+#define FIELD_RFL_FIELDS_466(f) FIELD_RFL_FIELDS_465(f), f(p465)
+#define FIELD_RFL_FIELDS_467(f) FIELD_RFL_FIELDS_466(f), f(p466)
+#define FIELD_RFL_FIELDS_468(f) FIELD_RFL_FIELDS_467(f), f(p467)
+#define FIELD_RFL_FIELDS_469(f) FIELD_RFL_FIELDS_468(f), f(p468)
+#define FIELD_RFL_FIELDS_470(f) FIELD_RFL_FIELDS_469(f), f(p469)
+#define FIELD_RFL_FIELDS_471(f) FIELD_RFL_FIELDS_470(f), f(p470)
+#define FIELD_RFL_FIELDS_472(f) FIELD_RFL_FIELDS_471(f), f(p471)
+#define FIELD_RFL_FIELDS_473(f) FIELD_RFL_FIELDS_472(f), f(p472)
+#define FIELD_RFL_FIELDS_474(f) FIELD_RFL_FIELDS_473(f), f(p473)
+#define FIELD_RFL_FIELDS_475(f) FIELD_RFL_FIELDS_474(f), f(p474)
+#define FIELD_RFL_FIELDS_476(f) FIELD_RFL_FIELDS_475(f), f(p475)
+#define FIELD_RFL_FIELDS_477(f) FIELD_RFL_FIELDS_476(f), f(p476)
+#define FIELD_RFL_FIELDS_478(f) FIELD_RFL_FIELDS_477(f), f(p477)
+#define FIELD_RFL_FIELDS_479(f) FIELD_RFL_FIELDS_478(f), f(p478)
+#define FIELD_RFL_FIELDS_480(f) FIELD_RFL_FIELDS_479(f), f(p479)
+        TO_TUPLE_TEMPLATE(465)
+        TO_TUPLE_TEMPLATE(466)
+        TO_TUPLE_TEMPLATE(467)
+        TO_TUPLE_TEMPLATE(468)
+        TO_TUPLE_TEMPLATE(469)
+        TO_TUPLE_TEMPLATE(470)
+        TO_TUPLE_TEMPLATE(471)
+        TO_TUPLE_TEMPLATE(472)
+        TO_TUPLE_TEMPLATE(473)
+        TO_TUPLE_TEMPLATE(474)
+        TO_TUPLE_TEMPLATE(475)
+        TO_TUPLE_TEMPLATE(476)
+        TO_TUPLE_TEMPLATE(477)
+        TO_TUPLE_TEMPLATE(478)
+        TO_TUPLE_TEMPLATE(479)
+        TO_TUPLE_TEMPLATE(480)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 480
+#define FIELD_RFL_FIELDS_481(f) FIELD_RFL_FIELDS_480(f), f(p480)
+#define FIELD_RFL_FIELDS_482(f) FIELD_RFL_FIELDS_481(f), f(p481)
+#define FIELD_RFL_FIELDS_483(f) FIELD_RFL_FIELDS_482(f), f(p482)
+#define FIELD_RFL_FIELDS_484(f) FIELD_RFL_FIELDS_483(f), f(p483)
+#define FIELD_RFL_FIELDS_485(f) FIELD_RFL_FIELDS_484(f), f(p484)
+#define FIELD_RFL_FIELDS_486(f) FIELD_RFL_FIELDS_485(f), f(p485)
+#define FIELD_RFL_FIELDS_487(f) FIELD_RFL_FIELDS_486(f), f(p486)
+#define FIELD_RFL_FIELDS_488(f) FIELD_RFL_FIELDS_487(f), f(p487)
+#define FIELD_RFL_FIELDS_489(f) FIELD_RFL_FIELDS_488(f), f(p488)
+#define FIELD_RFL_FIELDS_490(f) FIELD_RFL_FIELDS_489(f), f(p489)
+#define FIELD_RFL_FIELDS_491(f) FIELD_RFL_FIELDS_490(f), f(p490)
+#define FIELD_RFL_FIELDS_492(f) FIELD_RFL_FIELDS_491(f), f(p491)
+#define FIELD_RFL_FIELDS_493(f) FIELD_RFL_FIELDS_492(f), f(p492)
+#define FIELD_RFL_FIELDS_494(f) FIELD_RFL_FIELDS_493(f), f(p493)
+#define FIELD_RFL_FIELDS_495(f) FIELD_RFL_FIELDS_494(f), f(p494)
+#define FIELD_RFL_FIELDS_496(f) FIELD_RFL_FIELDS_495(f), f(p495)
+        TO_TUPLE_TEMPLATE(481)
+        TO_TUPLE_TEMPLATE(482)
+        TO_TUPLE_TEMPLATE(483)
+        TO_TUPLE_TEMPLATE(484)
+        TO_TUPLE_TEMPLATE(485)
+        TO_TUPLE_TEMPLATE(486)
+        TO_TUPLE_TEMPLATE(487)
+        TO_TUPLE_TEMPLATE(488)
+        TO_TUPLE_TEMPLATE(489)
+        TO_TUPLE_TEMPLATE(490)
+        TO_TUPLE_TEMPLATE(491)
+        TO_TUPLE_TEMPLATE(492)
+        TO_TUPLE_TEMPLATE(493)
+        TO_TUPLE_TEMPLATE(494)
+        TO_TUPLE_TEMPLATE(495)
+        TO_TUPLE_TEMPLATE(496)
+#endif
+#if FIELD_RFL_MAX_FIELDS > 496
+#define FIELD_RFL_FIELDS_497(f) FIELD_RFL_FIELDS_496(f), f(p496)
+#define FIELD_RFL_FIELDS_498(f) FIELD_RFL_FIELDS_497(f), f(p497)
+#define FIELD_RFL_FIELDS_499(f) FIELD_RFL_FIELDS_498(f), f(p498)
+#define FIELD_RFL_FIELDS_500(f) FIELD_RFL_FIELDS_499(f), f(p499)
+#define FIELD_RFL_FIELDS_501(f) FIELD_RFL_FIELDS_500(f), f(p500)
+#define FIELD_RFL_FIELDS_502(f) FIELD_RFL_FIELDS_501(f), f(p501)
+#define FIELD_RFL_FIELDS_503(f) FIELD_RFL_FIELDS_502(f), f(p502)
+#define FIELD_RFL_FIELDS_504(f) FIELD_RFL_FIELDS_503(f), f(p503)
+#define FIELD_RFL_FIELDS_505(f) FIELD_RFL_FIELDS_504(f), f(p504)
+#define FIELD_RFL_FIELDS_506(f) FIELD_RFL_FIELDS_505(f), f(p505)
+#define FIELD_RFL_FIELDS_507(f) FIELD_RFL_FIELDS_506(f), f(p506)
+#define FIELD_RFL_FIELDS_508(f) FIELD_RFL_FIELDS_507(f), f(p507)
+#define FIELD_RFL_FIELDS_509(f) FIELD_RFL_FIELDS_508(f), f(p508)
+#define FIELD_RFL_FIELDS_510(f) FIELD_RFL_FIELDS_509(f), f(p509)
+#define FIELD_RFL_FIELDS_511(f) FIELD_RFL_FIELDS_510(f), f(p510)
+#define FIELD_RFL_FIELDS_512(f) FIELD_RFL_FIELDS_511(f), f(p511)
+        TO_TUPLE_TEMPLATE(497)
+        TO_TUPLE_TEMPLATE(498)
+        TO_TUPLE_TEMPLATE(499)
+        TO_TUPLE_TEMPLATE(500)
+        TO_TUPLE_TEMPLATE(501)
+        TO_TUPLE_TEMPLATE(502)
+        TO_TUPLE_TEMPLATE(503)
+        TO_TUPLE_TEMPLATE(504)
+        TO_TUPLE_TEMPLATE(505)
+        TO_TUPLE_TEMPLATE(506)
+        TO_TUPLE_TEMPLATE(507)
+        TO_TUPLE_TEMPLATE(508)
+        TO_TUPLE_TEMPLATE(509)
+        TO_TUPLE_TEMPLATE(510)
+        TO_TUPLE_TEMPLATE(511)
+        TO_TUPLE_TEMPLATE(512)
+#endif
+#undef FIELD_RFL_FIELDS_1
+#undef FIELD_RFL_FIELDS_2
+#undef FIELD_RFL_FIELDS_3
+#undef FIELD_RFL_FIELDS_4
+#undef FIELD_RFL_FIELDS_5
+#undef FIELD_RFL_FIELDS_6
+#undef FIELD_RFL_FIELDS_7
+#undef FIELD_RFL_FIELDS_8
+#undef FIELD_RFL_FIELDS_9
+#undef FIELD_RFL_FIELDS_10
+#undef FIELD_RFL_FIELDS_11
+#undef FIELD_RFL_FIELDS_12
+#undef FIELD_RFL_FIELDS_13
+#undef FIELD_RFL_FIELDS_14
+#undef FIELD_RFL_FIELDS_15
+#undef FIELD_RFL_FIELDS_16
+#if FIELD_RFL_MAX_FIELDS > 16
+#undef FIELD_RFL_FIELDS_17
+#undef FIELD_RFL_FIELDS_18
+#undef FIELD_RFL_FIELDS_19
+#undef FIELD_RFL_FIELDS_20
+#undef FIELD_RFL_FIELDS_21
+#undef FIELD_RFL_FIELDS_22
+#undef FIELD_RFL_FIELDS_23
+#undef FIELD_RFL_FIELDS_24
+#undef FIELD_RFL_FIELDS_25
+#undef FIELD_RFL_FIELDS_26
+#undef FIELD_RFL_FIELDS_27
+#undef FIELD_RFL_FIELDS_28
+#undef FIELD_RFL_FIELDS_29
+#undef FIELD_RFL_FIELDS_30
+#undef FIELD_RFL_FIELDS_31
+#undef FIELD_RFL_FIELDS_32
+#endif
+#if FIELD_RFL_MAX_FIELDS > 32
+#undef FIELD_RFL_FIELDS_33
+#undef FIELD_RFL_FIELDS_34
+#undef FIELD_RFL_FIELDS_35
+#undef FIELD_RFL_FIELDS_36
+#undef FIELD_RFL_FIELDS_37
+#undef FIELD_RFL_FIELDS_38
+#undef FIELD_RFL_FIELDS_39
+#undef FIELD_RFL_FIELDS_40
+#undef FIELD_RFL_FIELDS_41
+#undef FIELD_RFL_FIELDS_42
+#undef FIELD_RFL_FIELDS_43
+#undef FIELD_RFL_FIELDS_44
+#undef FIELD_RFL_FIELDS_45
+#undef FIELD_RFL_FIELDS_46
+#undef FIELD_RFL_FIELDS_47
+#undef FIELD_RFL_FIELDS_48
+#endif
+#if FIELD_RFL_MAX_FIELDS > 48
+#undef FIELD_RFL_FIELDS_49
+#undef FIELD_RFL_FIELDS_50
+#undef FIELD_RFL_FIELDS_51
+#undef FIELD_RFL_FIELDS_52
+#undef FIELD_RFL_FIELDS_53
+#undef FIELD_RFL_FIELDS_54
+#undef FIELD_RFL_FIELDS_55
+#undef FIELD_RFL_FIELDS_56
+#undef FIELD_RFL_FIELDS_57
+#undef FIELD_RFL_FIELDS_58
+#undef FIELD_RFL_FIELDS_59
+#undef FIELD_RFL_FIELDS_60
+#undef FIELD_RFL_FIELDS_61
+#undef FIELD_RFL_FIELDS_62
+#undef FIELD_RFL_FIELDS_63
+#undef FIELD_RFL_FIELDS_64
+#endif
+#if FIELD_RFL_MAX_FIELDS > 64
+#undef FIELD_RFL_FIELDS_65
+#undef FIELD_RFL_FIELDS_66
+#undef FIELD_RFL_FIELDS_67
+#undef FIELD_RFL_FIELDS_68
+#undef FIELD_RFL_FIELDS_69
+#undef FIELD_RFL_FIELDS_70
+#undef FIELD_RFL_FIELDS_71
+#undef FIELD_RFL_FIELDS_72
+#undef FIELD_RFL_FIELDS_73
+#undef FIELD_RFL_FIELDS_74
+#undef FIELD_RFL_FIELDS_75
+#undef FIELD_RFL_FIELDS_76
+#undef FIELD_RFL_FIELDS_77
+#undef FIELD_RFL_FIELDS_78
+#undef FIELD_RFL_FIELDS_79
+#undef FIELD_RFL_FIELDS_80
+#endif
+#if FIELD_RFL_MAX_FIELDS > 80
+#undef FIELD_RFL_FIELDS_81
+#undef FIELD_RFL_FIELDS_82
+#undef FIELD_RFL_FIELDS_83
+#undef FIELD_RFL_FIELDS_84
+#undef FIELD_RFL_FIELDS_85
+#undef FIELD_RFL_FIELDS_86
+#undef FIELD_RFL_FIELDS_87
+#undef FIELD_RFL_FIELDS_88
+#undef FIELD_RFL_FIELDS_89
+#undef FIELD_RFL_FIELDS_90
+#undef FIELD_RFL_FIELDS_91
+#undef FIELD_RFL_FIELDS_92
+#undef FIELD_RFL_FIELDS_93
+#undef FIELD_RFL_FIELDS_94
+#undef FIELD_RFL_FIELDS_95
+#undef FIELD_RFL_FIELDS_96
+#endif
+#if FIELD_RFL_MAX_FIELDS > 96
+#undef FIELD_RFL_FIELDS_97
+#undef FIELD_RFL_FIELDS_98
+#undef FIELD_RFL_FIELDS_99
+#undef FIELD_RFL_FIELDS_100
+#undef FIELD_RFL_FIELDS_101
+#undef FIELD_RFL_FIELDS_102
+#undef FIELD_RFL_FIELDS_103
+#undef FIELD_RFL_FIELDS_104
+#undef FIELD_RFL_FIELDS_105
+#undef FIELD_RFL_FIELDS_106
+#undef FIELD_RFL_FIELDS_107
+#undef FIELD_RFL_FIELDS_108
+#undef FIELD_RFL_FIELDS_109
+#undef FIELD_RFL_FIELDS_110
+#undef FIELD_RFL_FIELDS_111
+#undef FIELD_RFL_FIELDS_112
+#endif
+#if FIELD_RFL_MAX_FIELDS > 112
+#undef FIELD_RFL_FIELDS_113
+#undef FIELD_RFL_FIELDS_114
+#undef FIELD_RFL_FIELDS_115
+#undef FIELD_RFL_FIELDS_116
+#undef FIELD_RFL_FIELDS_117
+#undef FIELD_RFL_FIELDS_118
+#undef FIELD_RFL_FIELDS_119
+#undef FIELD_RFL_FIELDS_120
+#undef FIELD_RFL_FIELDS_121
+#undef FIELD_RFL_FIELDS_122
+#undef FIELD_RFL_FIELDS_123
+#undef FIELD_RFL_FIELDS_124
+#undef FIELD_RFL_FIELDS_125
+#undef FIELD_RFL_FIELDS_126
+#undef FIELD_RFL_FIELDS_127
+#undef FIELD_RFL_FIELDS_128
+#endif
+#if FIELD_RFL_MAX_FIELDS > 128
+#undef FIELD_RFL_FIELDS_129
+#undef FIELD_RFL_FIELDS_130
+#undef FIELD_RFL_FIELDS_131
+#undef FIELD_RFL_FIELDS_132
+#undef FIELD_RFL_FIELDS_133
+#undef FIELD_RFL_FIELDS_134
+#undef FIELD_RFL_FIELDS_135
+#undef FIELD_RFL_FIELDS_136
+#undef FIELD_RFL_FIELDS_137
+#undef FIELD_RFL_FIELDS_138
+#undef FIELD_RFL_FIELDS_139
+#undef FIELD_RFL_FIELDS_140
+#undef FIELD_RFL_FIELDS_141
+#undef FIELD_RFL_FIELDS_142
+#undef FIELD_RFL_FIELDS_143
+#undef FIELD_RFL_FIELDS_144
+#endif
+#if FIELD_RFL_MAX_FIELDS > 144
+#undef FIELD_RFL_FIELDS_145
+#undef FIELD_RFL_FIELDS_146
+#undef FIELD_RFL_FIELDS_147
+#undef FIELD_RFL_FIELDS_148
+#undef FIELD_RFL_FIELDS_149
+#undef FIELD_RFL_FIELDS_150
+#undef FIELD_RFL_FIELDS_151
+#undef FIELD_RFL_FIELDS_152
+#undef FIELD_RFL_FIELDS_153
+#undef FIELD_RFL_FIELDS_154
+#undef FIELD_RFL_FIELDS_155
+#undef FIELD_RFL_FIELDS_156
+#undef FIELD_RFL_FIELDS_157
+#undef FIELD_RFL_FIELDS_158
+#undef FIELD_RFL_FIELDS_159
+#undef FIELD_RFL_FIELDS_160
+#endif
+#if FIELD_RFL_MAX_FIELDS > 160
+#undef FIELD_RFL_FIELDS_161
+#undef FIELD_RFL_FIELDS_162
+#undef FIELD_RFL_FIELDS_163
+#undef FIELD_RFL_FIELDS_164
+#undef FIELD_RFL_FIELDS_165
+#undef FIELD_RFL_FIELDS_166
+#undef FIELD_RFL_FIELDS_167
+#undef FIELD_RFL_FIELDS_168
+#undef FIELD_RFL_FIELDS_169
+#undef FIELD_RFL_FIELDS_170
+#undef FIELD_RFL_FIELDS_171
+#undef FIELD_RFL_FIELDS_172
+#undef FIELD_RFL_FIELDS_173
+#undef FIELD_RFL_FIELDS_174
+#undef FIELD_RFL_FIELDS_175
+#undef FIELD_RFL_FIELDS_176
+#endif
+#if FIELD_RFL_MAX_FIELDS > 176
+#undef FIELD_RFL_FIELDS_177
+#undef FIELD_RFL_FIELDS_178
+#undef FIELD_RFL_FIELDS_179
+#undef FIELD_RFL_FIELDS_180
+#undef FIELD_RFL_FIELDS_181
+#undef FIELD_RFL_FIELDS_182
+#undef FIELD_RFL_FIELDS_183
+#undef FIELD_RFL_FIELDS_184
+#undef FIELD_RFL_FIELDS_185
+#undef FIELD_RFL_FIELDS_186
+#undef FIELD_RFL_FIELDS_187
+#undef FIELD_RFL_FIELDS_188
+#undef FIELD_RFL_FIELDS_189
+#undef FIELD_RFL_FIELDS_190
+#undef FIELD_RFL_FIELDS_191
+#undef FIELD_RFL_FIELDS_192
+#endif
+#if FIELD_RFL_MAX_FIELDS > 192
+#undef FIELD_RFL_FIELDS_193
+#undef FIELD_RFL_FIELDS_194
+#undef FIELD_RFL_FIELDS_195
+#undef FIELD_RFL_FIELDS_196
+#undef FIELD_RFL_FIELDS_197
+#undef FIELD_RFL_FIELDS_198
+#undef FIELD_RFL_FIELDS_199
+#undef FIELD_RFL_FIELDS_200
+#undef FIELD_RFL_FIELDS_201
+#undef FIELD_RFL_FIELDS_202
+#undef FIELD_RFL_FIELDS_203
+#undef FIELD_RFL_FIELDS_204
+#undef FIELD_RFL_FIELDS_205
+#undef FIELD_RFL_FIELDS_206
+#undef FIELD_RFL_FIELDS_207
+#undef FIELD_RFL_FIELDS_208
+#endif
+#if FIELD_RFL_MAX_FIELDS > 208
+#undef FIELD_RFL_FIELDS_209
+#undef FIELD_RFL_FIELDS_210
+#undef FIELD_RFL_FIELDS_211
+#undef FIELD_RFL_FIELDS_212
+#undef FIELD_RFL_FIELDS_213
+#undef FIELD_RFL_FIELDS_214
+#undef FIELD_RFL_FIELDS_215
+#undef FIELD_RFL_FIELDS_216
+#undef FIELD_RFL_FIELDS_217
+#undef FIELD_RFL_FIELDS_218
+#undef FIELD_RFL_FIELDS_219
+#undef FIELD_RFL_FIELDS_220
+#undef FIELD_RFL_FIELDS_221
+#undef FIELD_RFL_FIELDS_222
+#undef FIELD_RFL_FIELDS_223
+#undef FIELD_RFL_FIELDS_224
+#endif
+#if FIELD_RFL_MAX_FIELDS > 224
+#undef FIELD_RFL_FIELDS_225
+#undef FIELD_RFL_FIELDS_226
+#undef FIELD_RFL_FIELDS_227
+#undef FIELD_RFL_FIELDS_228
+#undef FIELD_RFL_FIELDS_229
+#undef FIELD_RFL_FIELDS_230
+#undef FIELD_RFL_FIELDS_231
+#undef FIELD_RFL_FIELDS_232
+#undef FIELD_RFL_FIELDS_233
+#undef FIELD_RFL_FIELDS_234
+#undef FIELD_RFL_FIELDS_235
+#undef FIELD_RFL_FIELDS_236
+#undef FIELD_RFL_FIELDS_237
+#undef FIELD_RFL_FIELDS_238
+#undef FIELD_RFL_FIELDS_239
+#undef FIELD_RFL_FIELDS_240
+#endif
+#if FIELD_RFL_MAX_FIELDS > 240
+#undef FIELD_RFL_FIELDS_241
+#undef FIELD_RFL_FIELDS_242
+#undef FIELD_RFL_FIELDS_243
+#undef FIELD_RFL_FIELDS_244
+#undef FIELD_RFL_FIELDS_245
+#undef FIELD_RFL_FIELDS_246
+#undef FIELD_RFL_FIELDS_247
+#undef FIELD_RFL_FIELDS_248
+#undef FIELD_RFL_FIELDS_249
+#undef FIELD_RFL_FIELDS_250
+#undef FIELD_RFL_FIELDS_251
+#undef FIELD_RFL_FIELDS_252
+#undef FIELD_RFL_FIELDS_253
+#undef FIELD_RFL_FIELDS_254
+#undef FIELD_RFL_FIELDS_255
+#undef FIELD_RFL_FIELDS_256
+#endif
+#if FIELD_RFL_MAX_FIELDS > 256
+#undef FIELD_RFL_FIELDS_257
+#undef FIELD_RFL_FIELDS_258
+#undef FIELD_RFL_FIELDS_259
+#undef FIELD_RFL_FIELDS_260
+#undef FIELD_RFL_FIELDS_261
+#undef FIELD_RFL_FIELDS_262
+#undef FIELD_RFL_FIELDS_263
+#undef FIELD_RFL_FIELDS_264
+#undef FIELD_RFL_FIELDS_265
+#undef FIELD_RFL_FIELDS_266
+#undef FIELD_RFL_FIELDS_267
+#undef FIELD_RFL_FIELDS_268
+#undef FIELD_RFL_FIELDS_269
+#undef FIELD_RFL_FIELDS_270
+#undef FIELD_RFL_FIELDS_271
+#undef FIELD_RFL_FIELDS_272
+#endif
+#if FIELD_RFL_MAX_FIELDS > 272
+#undef FIELD_RFL_FIELDS_273
+#undef FIELD_RFL_FIELDS_274
+#undef FIELD_RFL_FIELDS_275
+#undef FIELD_RFL_FIELDS_276
+#undef FIELD_RFL_FIELDS_277
+#undef FIELD_RFL_FIELDS_278
+#undef FIELD_RFL_FIELDS_279
+#undef FIELD_RFL_FIELDS_280
+#undef FIELD_RFL_FIELDS_281
+#undef FIELD_RFL_FIELDS_282
+#undef FIELD_RFL_FIELDS_283
+#undef FIELD_RFL_FIELDS_284
+#undef FIELD_RFL_FIELDS_285
+#undef FIELD_RFL_FIELDS_286
+#undef FIELD_RFL_FIELDS_287
+#undef FIELD_RFL_FIELDS_288
+#endif
+#if FIELD_RFL_MAX_FIELDS > 288
+#undef FIELD_RFL_FIELDS_289
+#undef FIELD_RFL_FIELDS_290
+#undef FIELD_RFL_FIELDS_291
+#undef FIELD_RFL_FIELDS_292
+#undef FIELD_RFL_FIELDS_293
+#undef FIELD_RFL_FIELDS_294
+#undef FIELD_RFL_FIELDS_295
+#undef FIELD_RFL_FIELDS_296
+#undef FIELD_RFL_FIELDS_297
+#undef FIELD_RFL_FIELDS_298
+#undef FIELD_RFL_FIELDS_299
+#undef FIELD_RFL_FIELDS_300
+#undef FIELD_RFL_FIELDS_301
+#undef FIELD_RFL_FIELDS_302
+#undef FIELD_RFL_FIELDS_303
+#undef FIELD_RFL_FIELDS_304
+#endif
+#if FIELD_RFL_MAX_FIELDS > 304
+#undef FIELD_RFL_FIELDS_305
+#undef FIELD_RFL_FIELDS_306
+#undef FIELD_RFL_FIELDS_307
+#undef FIELD_RFL_FIELDS_308
+#undef FIELD_RFL_FIELDS_309
+#undef FIELD_RFL_FIELDS_310
+#undef FIELD_RFL_FIELDS_311
+#undef FIELD_RFL_FIELDS_312
+#undef FIELD_RFL_FIELDS_313
+#undef FIELD_RFL_FIELDS_314
+#undef FIELD_RFL_FIELDS_315
+#undef FIELD_RFL_FIELDS_316
+#undef FIELD_RFL_FIELDS_317
+#undef FIELD_RFL_FIELDS_318
+#undef FIELD_RFL_FIELDS_319
+#undef FIELD_RFL_FIELDS_320
+#endif
+#if FIELD_RFL_MAX_FIELDS > 320
+#undef FIELD_RFL_FIELDS_321
+#undef FIELD_RFL_FIELDS_322
+#undef FIELD_RFL_FIELDS_323
+#undef FIELD_RFL_FIELDS_324
+#undef FIELD_RFL_FIELDS_325
+#undef FIELD_RFL_FIELDS_326
+#undef FIELD_RFL_FIELDS_327
+#undef FIELD_RFL_FIELDS_328
+#undef FIELD_RFL_FIELDS_329
+#undef FIELD_RFL_FIELDS_330
+#undef FIELD_RFL_FIELDS_331
+#undef FIELD_RFL_FIELDS_332
+#undef FIELD_RFL_FIELDS_333
+#undef FIELD_RFL_FIELDS_334
+#undef FIELD_RFL_FIELDS_335
+#undef FIELD_RFL_FIELDS_336
+#endif
+#if FIELD_RFL_MAX_FIELDS > 336
+#undef FIELD_RFL_FIELDS_337
+#undef FIELD_RFL_FIELDS_338
+#undef FIELD_RFL_FIELDS_339
+#undef FIELD_RFL_FIELDS_340
+#undef FIELD_RFL_FIELDS_341
+#undef FIELD_RFL_FIELDS_342
+#undef FIELD_RFL_FIELDS_343
+#undef FIELD_RFL_FIELDS_344
+#undef FIELD_RFL_FIELDS_345
+#undef FIELD_RFL_FIELDS_346
+#undef FIELD_RFL_FIELDS_347
+#undef FIELD_RFL_FIELDS_348
+#undef FIELD_RFL_FIELDS_349
+#undef FIELD_RFL_FIELDS_350
+#undef FIELD_RFL_FIELDS_351
+#undef FIELD_RFL_FIELDS_352
+#endif
+#if FIELD_RFL_MAX_FIELDS > 352
+#undef FIELD_RFL_FIELDS_353
+#undef FIELD_RFL_FIELDS_354
+#undef FIELD_RFL_FIELDS_355
+#undef FIELD_RFL_FIELDS_356
+#undef FIELD_RFL_FIELDS_357
+#undef FIELD_RFL_FIELDS_358
+#undef FIELD_RFL_FIELDS_359
+#undef FIELD_RFL_FIELDS_360
+#undef FIELD_RFL_FIELDS_361
+#undef FIELD_RFL_FIELDS_362
+#undef FIELD_RFL_FIELDS_363
+#undef FIELD_RFL_FIELDS_364
+#undef FIELD_RFL_FIELDS_365
+#undef FIELD_RFL_FIELDS_366
+#undef FIELD_RFL_FIELDS_367
+#undef FIELD_RFL_FIELDS_368
+#endif
+#if FIELD_RFL_MAX_FIELDS > 368
+#undef FIELD_RFL_FIELDS_369
+#undef FIELD_RFL_FIELDS_370
+#undef FIELD_RFL_FIELDS_371
+#undef FIELD_RFL_FIELDS_372
+#undef FIELD_RFL_FIELDS_373
+#undef FIELD_RFL_FIELDS_374
+#undef FIELD_RFL_FIELDS_375
+#undef FIELD_RFL_FIELDS_376
+#undef FIELD_RFL_FIELDS_377
+#undef FIELD_RFL_FIELDS_378
+#undef FIELD_RFL_FIELDS_379
+#undef FIELD_RFL_FIELDS_380
+#undef FIELD_RFL_FIELDS_381
+#undef FIELD_RFL_FIELDS_382
+#undef FIELD_RFL_FIELDS_383
+#undef FIELD_RFL_FIELDS_384
+#endif
+#if FIELD_RFL_MAX_FIELDS > 384
+#undef FIELD_RFL_FIELDS_385
+#undef FIELD_RFL_FIELDS_386
+#undef FIELD_RFL_FIELDS_387
+#undef FIELD_RFL_FIELDS_388
+#undef FIELD_RFL_FIELDS_389
+#undef FIELD_RFL_FIELDS_390
+#undef FIELD_RFL_FIELDS_391
+#undef FIELD_RFL_FIELDS_392
+#undef FIELD_RFL_FIELDS_393
+#undef FIELD_RFL_FIELDS_394
+#undef FIELD_RFL_FIELDS_395
+#undef FIELD_RFL_FIELDS_396
+#undef FIELD_RFL_FIELDS_397
+#undef FIELD_RFL_FIELDS_398
+#undef FIELD_RFL_FIELDS_399
+#undef FIELD_RFL_FIELDS_400
+#endif
+#if FIELD_RFL_MAX_FIELDS > 400
+#undef FIELD_RFL_FIELDS_401
+#undef FIELD_RFL_FIELDS_402
+#undef FIELD_RFL_FIELDS_403
+#undef FIELD_RFL_FIELDS_404
+#undef FIELD_RFL_FIELDS_405
+#undef FIELD_RFL_FIELDS_406
+#undef FIELD_RFL_FIELDS_407
+#undef FIELD_RFL_FIELDS_408
+#undef FIELD_RFL_FIELDS_409
+#undef FIELD_RFL_FIELDS_410
+#undef FIELD_RFL_FIELDS_411
+#undef FIELD_RFL_FIELDS_412
+#undef FIELD_RFL_FIELDS_413
+#undef FIELD_RFL_FIELDS_414
+#undef FIELD_RFL_FIELDS_415
+#undef FIELD_RFL_FIELDS_416
+#endif
+#if FIELD_RFL_MAX_FIELDS > 416
+#undef FIELD_RFL_FIELDS_417
+#undef FIELD_RFL_FIELDS_418
+#undef FIELD_RFL_FIELDS_419
+#undef FIELD_RFL_FIELDS_420
+#undef FIELD_RFL_FIELDS_421
+#undef FIELD_RFL_FIELDS_422
+#undef FIELD_RFL_FIELDS_423
+#undef FIELD_RFL_FIELDS_424
+#undef FIELD_RFL_FIELDS_425
+#undef FIELD_RFL_FIELDS_426
+#undef FIELD_RFL_FIELDS_427
+#undef FIELD_RFL_FIELDS_428
+#undef FIELD_RFL_FIELDS_429
+#undef FIELD_RFL_FIELDS_430
+#undef FIELD_RFL_FIELDS_431
+#undef FIELD_RFL_FIELDS_432
+#endif
+#if FIELD_RFL_MAX_FIELDS > 432
+#undef FIELD_RFL_FIELDS_433
+#undef FIELD_RFL_FIELDS_434
+#undef FIELD_RFL_FIELDS_435
+#undef FIELD_RFL_FIELDS_436
+#undef FIELD_RFL_FIELDS_437
+#undef FIELD_RFL_FIELDS_438
+#undef FIELD_RFL_FIELDS_439
+#undef FIELD_RFL_FIELDS_440
+#undef FIELD_RFL_FIELDS_441
+#undef FIELD_RFL_FIELDS_442
+#undef FIELD_RFL_FIELDS_443
+#undef FIELD_RFL_FIELDS_444
+#undef FIELD_RFL_FIELDS_445
+#undef FIELD_RFL_FIELDS_446
+#undef FIELD_RFL_FIELDS_447
+#undef FIELD_RFL_FIELDS_448
+#endif
+#if FIELD_RFL_MAX_FIELDS > 448
+#undef FIELD_RFL_FIELDS_449
+#undef FIELD_RFL_FIELDS_450
+#undef FIELD_RFL_FIELDS_451
+#undef FIELD_RFL_FIELDS_452
+#undef FIELD_RFL_FIELDS_453
+#undef FIELD_RFL_FIELDS_454
+#undef FIELD_RFL_FIELDS_455
+#undef FIELD_RFL_FIELDS_456
+#undef FIELD_RFL_FIELDS_457
+#undef FIELD_RFL_FIELDS_458
+#undef FIELD_RFL_FIELDS_459
+#undef FIELD_RFL_FIELDS_460
+#undef FIELD_RFL_FIELDS_461
+#undef FIELD_RFL_FIELDS_462
+#undef FIELD_RFL_FIELDS_463
+#undef FIELD_RFL_FIELDS_464
+#endif
+#if FIELD_RFL_MAX_FIELDS > 464
+#undef FIELD_RFL_FIELDS_465
+#undef FIELD_RFL_FIELDS_466
+#undef FIELD_RFL_FIELDS_467
+#undef FIELD_RFL_FIELDS_468
+#undef FIELD_RFL_FIELDS_469
+#undef FIELD_RFL_FIELDS_470
+#undef FIELD_RFL_FIELDS_471
+#undef FIELD_RFL_FIELDS_472
+#undef FIELD_RFL_FIELDS_473
+#undef FIELD_RFL_FIELDS_474
+#undef FIELD_RFL_FIELDS_475
+#undef FIELD_RFL_FIELDS_476
+#undef FIELD_RFL_FIELDS_477
+#undef FIELD_RFL_FIELDS_478
+#undef FIELD_RFL_FIELDS_479
+#undef FIELD_RFL_FIELDS_480
+#endif
+#if FIELD_RFL_MAX_FIELDS > 480
+#undef FIELD_RFL_FIELDS_481
+#undef FIELD_RFL_FIELDS_482
+#undef FIELD_RFL_FIELDS_483
+#undef FIELD_RFL_FIELDS_484
+#undef FIELD_RFL_FIELDS_485
+#undef FIELD_RFL_FIELDS_486
+#undef FIELD_RFL_FIELDS_487
+#undef FIELD_RFL_FIELDS_488
+#undef FIELD_RFL_FIELDS_489
+#undef FIELD_RFL_FIELDS_490
+#undef FIELD_RFL_FIELDS_491
+#undef FIELD_RFL_FIELDS_492
+#undef FIELD_RFL_FIELDS_493
+#undef FIELD_RFL_FIELDS_494
+#undef FIELD_RFL_FIELDS_495
+#undef FIELD_RFL_FIELDS_496
+#endif
+#if FIELD_RFL_MAX_FIELDS > 496
+#undef FIELD_RFL_FIELDS_497
+#undef FIELD_RFL_FIELDS_498
+#undef FIELD_RFL_FIELDS_499
+#undef FIELD_RFL_FIELDS_500
+#undef FIELD_RFL_FIELDS_501
+#undef FIELD_RFL_FIELDS_502
+#undef FIELD_RFL_FIELDS_503
+#undef FIELD_RFL_FIELDS_504
+#undef FIELD_RFL_FIELDS_505
+#undef FIELD_RFL_FIELDS_506
+#undef FIELD_RFL_FIELDS_507
+#undef FIELD_RFL_FIELDS_508
+#undef FIELD_RFL_FIELDS_509
+#undef FIELD_RFL_FIELDS_510
+#undef FIELD_RFL_FIELDS_511
+#undef FIELD_RFL_FIELDS_512
+#endif
+#undef FIELD_RFL_IDENTITY
+#undef FIELD_RFL_ADDR
 #undef FIELD_RFL_DECLTYPE
-#undef FIELD_RFL_FIELD_TYPE
 #undef FIELD_RFL_FORWARD
-#undef FIELD_RFL_ADDR
-#undef FIELD_RFL_MOVE
-#undef FIELD_RFL_TO_TUPLE_TEMPLATE
+#undef FIELD_RFL_FORWARD_FIELD
+#undef TO_TUPLE_TEMPLATE
+#endif
 #pragma endregion TO_TUPLE_TEMPLATE_MACRO
 
 #if defined(__clang__)
@@ -674,12 +2079,96 @@ namespace field_reflection
             return field_name_raw.substr(begin, last - begin);
         }
 
+        // the names of all fields packed into one buffer, each terminated by NUL, so that only the names and not the
+        // function signatures they are parsed from are emitted to the binary
+        template <field_namable T>
+        struct field_name_storage
+        {
+            // views of the function signatures, only used in constant expressions
+            static constexpr auto raw_names = []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return std::array<std::string_view, sizeof...(Is)>{get_field_name<T, get_ptr<T, Is>()>()...};
+            }(std::make_index_sequence<field_count<T>>());
+
+            static constexpr auto size = []() {
+                auto result = std::size_t{0};
+                for (const auto name : raw_names) result += name.size() + 1;
+                return result;
+            }();
+
+            static constexpr auto chars = []() {
+                auto result = std::array<char, size>{};
+                auto it = result.begin();
+                for (const auto name : raw_names)
+                {
+                    for (auto c : name) *it++ = c;
+                    *it++ = '\0';
+                }
+                return result;
+            }();
+
+            static constexpr auto names = []() {
+                auto result = std::array<std::string_view, field_count<T>>{};
+                auto offset = std::size_t{0};
+                for (std::size_t i = 0; i < result.size(); ++i)
+                {
+                    result[i] = std::string_view(chars.data() + offset, raw_names[i].size());
+                    offset += raw_names[i].size() + 1;
+                }
+                return result;
+            }();
+        };
+
+        template <field_namable T>
+        constexpr const std::array<std::string_view, field_count<T>>& field_names = field_name_storage<T>::names;
+
         template <field_namable T, std::size_t N>
-        constexpr std::string_view field_name = get_field_name<T, get_ptr<T, N>()>();
+        constexpr std::string_view field_name = field_names<T>[N];
 
         template <field_referenceable T, std::size_t N>
         using field_type = std::tuple_element_t<N, typename decltype(field_type_tuple<T>())::type>;
 
+        // reference members are stored as pointers
+        template <typename T>
+        using field_object_type = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, T>;
+
+        template <field_referenceable T, std::size_t N>
+        constexpr std::size_t field_size = sizeof(field_object_type<field_type<T, N>>);
+
+        struct field_layout
+        {
+            std::size_t offset;
+            std::size_t size;
+            std::size_t alignment;
+        };
+
+        // The layout is derived from the field types by the usual rules where the alignment of the struct caps that of
+        // the fields (e.g. packed structs). It is only valid if it is consistent with the size of the struct, which
+        // excludes bit-fields, over-aligned members and so on.
+        template <field_referenceable T, std::size_t N>
+        constexpr std::size_t field_alignment = alignof(field_object_type<field_type<T, N>>) < alignof(T)
+                                                    ? alignof(field_object_type<field_type<T, N>>)
+                                                    : alignof(T);
+
+        template <field_referenceable T>
+        constexpr auto field_layout_value = []<std::size_t... Is>(std::index_sequence<Is...>) {
+            auto result =
+                std::array<field_layout, sizeof...(Is)>{field_layout{0, field_size<T, Is>, field_alignment<T, Is>}...};
+            auto end = std::size_t{0};
+            for (auto& f : result)
+            {
+                f.offset = (end + f.alignment - 1) / f.alignment * f.alignment;
+                end = f.offset + f.size;
+            }
+            return result;
+        }(std::make_index_sequence<field_count<T>>());
+
+        template <field_referenceable T>
+        constexpr bool field_layout_consistent = []() {
+            const auto& fields = field_layout_value<T>;
+            const auto end = fields.empty() ? std::size_t{1} : fields.back().offset + fields.back().size;
+            return (end + alignof(T) - 1) / alignof(T) * alignof(T) == sizeof(T);
+        }();
+
         struct type_name_detector
         {
         };
@@ -720,6 +2209,149 @@ namespace field_reflection
         template <class T>
         constexpr std::string_view type_name = get_type_name<T>();
 
+        constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        // FNV-1a
+        constexpr std::uint64_t hash_name(std::string_view name, std::uint64_t h = 14695981039346656037ULL) noexcept
+        {
+            for (const auto c : name)
+            {
+                h ^= static_cast<unsigned char>(c);
+                h *= 1099511628211ULL;
+            }
+            return h;
+        }
+
+        constexpr std::uint64_t mix_hash(std::uint64_t h, std::uint64_t seed) noexcept
+        {
+            h ^= seed * 0x9e3779b97f4a7c15ULL;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        template <std::size_t N>
+        struct field_index_table
+        {
+            std::array<std::uint64_t, N> seeds{};  // displacement of each bucket
+            std::array<std::size_t, N> indices{};  // field index of each slot
+            bool perfect = true;                   // false if no table is found, where the names are searched linearly
+        };
+
+        // seeds tried per bucket before giving up the perfect hash
+        inline constexpr std::uint64_t max_field_index_seeds = std::uint64_t{1} << 13;
+
+        // minimal perfect hash by hash and displace: a name falls into the bucket hash % N, and the bucket seed is
+        // searched so that all names in the bucket are mapped to distinct free slots; names with the same hash never
+        // get distinct slots, so the search is bounded and the lookup falls back to a linear search
+        template <field_namable T>
+        consteval auto make_field_index_table()
+        {
+            constexpr auto n = field_count<T>;
+            const auto& names = field_names<T>;
+
+            auto hashes = std::array<std::uint64_t, n>{};
+            auto bucket_sizes = std::array<std::size_t, n>{};
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                hashes[i] = hash_name(names[i]);
+                ++bucket_sizes[hashes[i] % n];
+            }
+
+            auto table = field_index_table<n>{};
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                for (std::size_t j = 0; j < i; ++j)
+                {
+                    if (hashes[i] == hashes[j])
+                    {
+                        table.perfect = false;
+                        return table;
+                    }
+                }
+            }
+
+            // place larger buckets first
+            auto order = std::array<std::size_t, n>{};
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                order[i] = i;
+            }
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                for (auto j = i; j > 0 && bucket_sizes[order[j - 1]] < bucket_sizes[order[j]]; --j)
+                {
+                    std::swap(order[j - 1], order[j]);
+                }
+            }
+
+            auto used = std::array<bool, n>{};
+            for (const auto bucket : order)
+            {
+                if (bucket_sizes[bucket] == 0) break;
+                for (std::uint64_t seed = 0;; ++seed)
+                {
+                    if (seed == max_field_index_seeds)
+                    {
+                        table.perfect = false;
+                        return table;
+                    }
+
+                    auto slots = std::array<std::size_t, n>{};
+                    auto count = std::size_t{0};
+                    auto ok = true;
+                    for (std::size_t i = 0; i < n && ok; ++i)
+                    {
+                        if (hashes[i] % n != bucket) continue;
+                        const auto slot = mix_hash(hashes[i], seed) % n;
+                        ok = !used[slot];
+                        for (std::size_t j = 0; j < count && ok; ++j)
+                        {
+                            ok = slots[j] != slot;
+                        }
+                        slots[count++] = slot;
+                    }
+                    if (!ok) continue;
+
+                    table.seeds[bucket] = seed;
+                    count = 0;
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        if (hashes[i] % n != bucket) continue;
+                        used[slots[count]] = true;
+                        table.indices[slots[count++]] = i;
+                    }
+                    break;
+                }
+            }
+            return table;
+        }
+
+        template <field_namable T>
+        constexpr auto field_index_table_value = make_field_index_table<T>();
+
+        template <field_namable T>
+        constexpr std::size_t field_index(std::string_view name) noexcept
+        {
+            constexpr auto n = field_count<T>;
+            if constexpr (!field_index_table_value<T>.perfect)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (field_names<T>[i] == name) return i;
+                }
+                return npos;
+            }
+            else
+            {
+                const auto& table = field_index_table_value<T>;
+                const auto h = hash_name(name);
+                const auto index = table.indices[mix_hash(h, table.seeds[h % n]) % n];
+                return field_names<T>[index] == name ? index : npos;
+            }
+        }
+
         template <std::size_t N, typename T, field_referenceable U = std::remove_cvref_t<T>>
         constexpr decltype(auto) get_field(T& t) noexcept
         {
@@ -730,181 +2362,907 @@ namespace field_reflection
         requires std::is_rvalue_reference_v<T&&>
         constexpr auto get_field(T&& t) noexcept
         {
-            return std::get<N>(to_tuple(std::forward<T>(t)));
+            // only the selected field is moved out of t
+            if constexpr (std::is_reference_v<field_type<U, N>>)
+            {
+                return get_field<N>(t);
+            }
+            else
+            {
+                return std::move(get_field<N>(t));
+            }
         }
 
-        template <typename Tuple, bool Move>
-        struct field_storage
+        template <typename T>
+        struct is_std_array : std::false_type
         {
-            Tuple fields;
         };
 
-        template <typename T>
-        constexpr auto make_field_storage(T&& t)
+        template <typename T, std::size_t N>
+        struct is_std_array<std::array<T, N>> : std::true_type
         {
-            if constexpr (std::is_rvalue_reference_v<T&&>)
+        };
+
+        // bytes of T beyond which the derived layout is not verified at compile time
+        inline constexpr std::size_t max_verified_layout_size = std::size_t{1} << 16;
+
+        // types made of scalars that std::bit_cast accepts in constant expressions, excluding pointers, references,
+        // unions, long double with its padding bits and non-trivially copyable types
+        template <typename F>
+        constexpr bool layout_bit_castable = []() {
+            if constexpr (is_std_array<F>::value)
+            {
+                return layout_bit_castable<typename F::value_type>;
+            }
+            else if constexpr (std::is_arithmetic_v<F> || std::is_enum_v<F>)
+            {
+                return !std::is_same_v<std::remove_cv_t<F>, long double>;
+            }
+            else if constexpr (field_referenceable<F> && std::is_trivially_copyable_v<F>)
             {
-                return field_storage<decltype(to_tuple(std::forward<T>(t))), true>{to_tuple(std::forward<T>(t))};
+                return []<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return (layout_bit_castable<field_type<F, Is>> && ...);
+                }(std::make_index_sequence<field_count<F>>());
             }
             else
             {
-                return field_storage<decltype(to_ptr_tuple(t)), false>{to_ptr_tuple(t)};
+                return false;
+            }
+        }();
+
+        // Whether the subobject of the type F at `offset` of Root, reached by get, lies at that offset. The bytes of
+        // each scalar in it are set to 0x01 and the others to zero, and the scalar read from the Root made of the
+        // bytes by std::bit_cast is compared with the expected value, which holds only if the scalar is at the
+        // offset.
+        template <typename Root, typename F, typename Get>
+        constexpr bool verify_layout_at(std::size_t offset, Get get)
+        {
+            if constexpr (is_std_array<F>::value)
+            {
+                if constexpr (std::tuple_size_v<F> == 0)
+                {
+                    return true;
+                }
+                else
+                {
+                    return verify_layout_at<Root, typename F::value_type>(
+                        offset, [get](const Root& r) -> decltype(auto) { return get(r)[0]; });
+                }
+            }
+            else if constexpr (std::is_arithmetic_v<F> || std::is_enum_v<F>)
+            {
+                auto bytes = std::array<unsigned char, sizeof(Root)>{};
+                for (std::size_t i = 0; i < sizeof(F); ++i) bytes[offset + i] = 1;
+                auto ones = std::array<unsigned char, sizeof(F)>{};
+                for (auto& b : ones) b = 1;
+                const auto root = std::bit_cast<Root>(bytes);
+                return get(root) == std::bit_cast<F>(ones);
+            }
+            else if constexpr (!field_layout_consistent<F>)
+            {
+                return false;
+            }
+            else
+            {
+                return []<std::size_t... Is>([[maybe_unused]] std::size_t base, [[maybe_unused]] Get g,
+                                             std::index_sequence<Is...>) {
+                    return (verify_layout_at<Root, std::remove_cv_t<field_type<F, Is>>>(
+                                base + field_layout_value<F>[Is].offset,
+                                [g](const Root& r) -> decltype(auto) { return get_field<Is>(g(r)); }) &&
+                            ...);
+                }(offset, get, std::make_index_sequence<field_count<F>>());
             }
         }
 
-        template <std::size_t N, typename Tuple, bool Move>
-        constexpr decltype(auto) get_stored_field(field_storage<Tuple, Move>& storage) noexcept
+        template <typename T>
+        constexpr bool verify_field_layout()
         {
-            if constexpr (Move)
+            if constexpr (!layout_bit_castable<T> || sizeof(T) > max_verified_layout_size)
             {
-                return std::get<N>(std::move(storage.fields));
+                return false;
             }
             else
             {
-                return *std::get<N>(storage.fields);
+                return verify_layout_at<T, T>(0, [](const T& t) -> const T& { return t; });
             }
         }
 
-        template <typename T, typename Func, std::size_t... Is, field_referenceable U = std::remove_cvref_t<T>>
-        void for_each_field_impl(T&& t, Func&& func, std::index_sequence<Is...>)
+        // the derived layout of T can be verified at compile time
+        template <typename T>
+        concept field_layout_checkable = field_referenceable<T> && layout_bit_castable<T> &&
+                                         sizeof(T) <= max_verified_layout_size &&
+                                         requires { typename std::bool_constant<verify_field_layout<T>()>; };
+
+        // derived layout consistent with sizeof(T) and not refuted at compile time; the layout of the other types
+        // is verified at run time by layout_verified
+        template <typename T>
+        concept field_layoutable = field_referenceable<T> && requires {
+            requires field_layout_consistent<T>;
+            requires(!field_layout_checkable<T> || verify_field_layout<T>());
+        };
+
+        // derived layout verified at compile time
+        template <typename T>
+        concept field_layout_proven = field_layoutable<T> && field_layout_checkable<T>;
+
+        // Whether the field addresses of an object of T are at the derived offsets. The object is not constructed,
+        // as T may not be default constructible, and only the addresses of its fields are taken; the addresses of
+        // reference fields are those of the referred objects, so such types are not verified.
+        template <typename T>
+        bool measure_field_layout() noexcept
         {
-            auto storage = make_field_storage(std::forward<T>(t));
-            if constexpr (requires { (func(get_stored_field<Is>(storage)), ...); })
+            if constexpr ([]<std::size_t... Is>(std::index_sequence<Is...>) {
+                              return (std::is_reference_v<field_type<T, Is>> || ...);
+                          }(std::make_index_sequence<field_count<T>>()))
+            {
+                return false;
+            }
+            else
             {
-                (func(get_stored_field<Is>(storage)), ...);
+                alignas(T) static unsigned char storage[sizeof(T)];  // NOLINT
+                const auto& t = *reinterpret_cast<const T*>(storage);  // NOLINT
+                return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return ((reinterpret_cast<const unsigned char*>(std::addressof(get_field<Is>(t))) ==  // NOLINT
+                             storage + field_layout_value<T>[Is].offset) &&
+                            ...);
+                }(std::make_index_sequence<field_count<T>>());
             }
-            else if constexpr (requires { (func(field_name<U, Is>, get_stored_field<Is>(storage)), ...); })
+        }
+
+        // whether the derived layout matches the real one, checked once at run time unless proven at compile time
+        template <field_layoutable T>
+        bool layout_verified() noexcept
+        {
+            if constexpr (field_layout_proven<T>)
             {
-                (func(field_name<U, Is>, get_stored_field<Is>(storage)), ...);
+                return true;
             }
             else
             {
-                static_assert(always_false<std::remove_cvref_t<Func>>,
-                              "invalid function object for call to for_each_field");
+                static const bool verified = measure_field_layout<T>();
+                return verified;
             }
         }
 
+        template <field_layoutable T, std::size_t N>
+        constexpr std::size_t field_offset = field_layout_value<T>[N].offset;
+
+        template <field_layoutable T>
+        constexpr const auto& layout = field_layout_value<T>;
+
+        template <field_layoutable T>
+        constexpr std::size_t padding_bytes = []() {
+            auto size = sizeof(T);
+            for (const auto& f : field_layout_value<T>)
+            {
+                size -= f.size;
+            }
+            return size;
+        }();
+
+        template <field_layoutable T>
+        constexpr bool has_padding = padding_bytes<T> != 0;
+
+// a cast instead of std::forward, which is a function call in unoptimized builds
+#define FIELD_RFL_FWD(x) static_cast<decltype(x)&&>(x)
+
+        template <typename T, typename Func, std::size_t... Is, field_referenceable U = std::remove_cvref_t<T>>
+        void for_each_field_impl(T&& t, Func&& func, std::index_sequence<Is...>)
+        {
+            invoke_with_fields(std::forward<T>(t), [&](auto&&... fields) {
+                if constexpr (requires { (func(FIELD_RFL_FWD(fields)), ...); })
+                {
+                    (func(FIELD_RFL_FWD(fields)), ...);
+                }
+                else if constexpr (requires { (func(field_name<U, Is>, FIELD_RFL_FWD(fields)), ...); })
+                {
+                    (func(field_name<U, Is>, FIELD_RFL_FWD(fields)), ...);
+                }
+                else
+                {
+                    static_assert(always_false<std::remove_cvref_t<Func>>,
+                                  "invalid function object for call to for_each_field");
+                }
+            });
+        }
+
         template <typename T1, typename T2, typename Func, std::size_t... Is,
                   field_referenceable U = std::remove_cvref_t<T1>>
         void for_each_field_impl(T1&& t1, T2&& t2, Func&& func, std::index_sequence<Is...>)
         {
-            auto storage1 = make_field_storage(std::forward<T1>(t1));
-            auto storage2 = make_field_storage(std::forward<T2>(t2));
-            if constexpr (requires { (func(get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)), ...); })
+            invoke_with_fields(std::forward<T1>(t1), [&](auto&&... fields1) {
+                invoke_with_fields(std::forward<T2>(t2), [&](auto&&... fields2) {
+                    if constexpr (requires { (func(FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)), ...); })
+                    {
+                        (func(FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)), ...);
+                    }
+                    else if constexpr (requires {
+                                           (func(field_name<U, Is>, FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)),
+                                            ...);
+                                       })
+                    {
+                        (func(field_name<U, Is>, FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)), ...);
+                    }
+                    else
+                    {
+                        static_assert(always_false<std::remove_cvref_t<Func>>,
+                                      "invalid function object for call to for_each_field");
+                    }
+                });
+            });
+        }
+
+        template <typename T, typename Func, std::size_t... Is, field_referenceable U = std::remove_cvref_t<T>>
+        bool all_of_field_impl(T&& t, Func&& func, std::index_sequence<Is...>)
+        {
+            return invoke_with_fields(std::forward<T>(t), [&](auto&&... fields) {
+                if constexpr (requires { (func(FIELD_RFL_FWD(fields)) && ...); })
+                {
+                    return (func(FIELD_RFL_FWD(fields)) && ...);
+                }
+                else if constexpr (requires { (func(field_name<U, Is>, FIELD_RFL_FWD(fields)) && ...); })
+                {
+                    return (func(field_name<U, Is>, FIELD_RFL_FWD(fields)) && ...);
+                }
+                else
+                {
+                    static_assert(always_false<std::remove_cvref_t<Func>>,
+                                  "invalid function object for call to all_of_field");
+                }
+            });
+        }
+
+        template <typename T1, typename T2, typename Func, std::size_t... Is,
+                  field_referenceable U = std::remove_cvref_t<T1>>
+        bool all_of_field_impl(T1&& t1, T2&& t2, Func&& func, std::index_sequence<Is...>)
+        {
+            return invoke_with_fields(std::forward<T1>(t1), [&](auto&&... fields1) {
+                return invoke_with_fields(std::forward<T2>(t2), [&](auto&&... fields2) {
+                    if constexpr (requires { (func(FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) && ...); })
+                    {
+                        return (func(FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) && ...);
+                    }
+                    else if constexpr (requires {
+                                           (func(field_name<U, Is>, FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) &&
+                                            ...);
+                                       })
+                    {
+                        return (func(field_name<U, Is>, FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) && ...);
+                    }
+                    else
+                    {
+                        static_assert(always_false<std::remove_cvref_t<Func>>,
+                                      "invalid function object for call to all_of_field");
+                    }
+                });
+            });
+        }
+
+        template <typename T, typename Func, std::size_t... Is, field_referenceable U = std::remove_cvref_t<T>>
+        bool any_of_field_impl(T&& t, Func&& func, std::index_sequence<Is...>)
+        {
+            return invoke_with_fields(std::forward<T>(t), [&](auto&&... fields) {
+                if constexpr (requires { (func(FIELD_RFL_FWD(fields)) || ...); })
+                {
+                    return (func(FIELD_RFL_FWD(fields)) || ...);
+                }
+                else if constexpr (requires { (func(field_name<U, Is>, FIELD_RFL_FWD(fields)) || ...); })
+                {
+                    return (func(field_name<U, Is>, FIELD_RFL_FWD(fields)) || ...);
+                }
+                else
+                {
+                    static_assert(always_false<std::remove_cvref_t<Func>>,
+                                  "invalid function object for call to any_of_field");
+                }
+            });
+        }
+
+        template <typename T1, typename T2, typename Func, std::size_t... Is,
+                  field_referenceable U = std::remove_cvref_t<T1>>
+        bool any_of_field_impl(T1&& t1, T2&& t2, Func&& func, std::index_sequence<Is...>)
+        {
+            return invoke_with_fields(std::forward<T1>(t1), [&](auto&&... fields1) {
+                return invoke_with_fields(std::forward<T2>(t2), [&](auto&&... fields2) {
+                    if constexpr (requires { (func(FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) || ...); })
+                    {
+                        return (func(FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) || ...);
+                    }
+                    else if constexpr (requires {
+                                           (func(field_name<U, Is>, FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) ||
+                                            ...);
+                                       })
+                    {
+                        return (func(field_name<U, Is>, FIELD_RFL_FWD(fields1), FIELD_RFL_FWD(fields2)) || ...);
+                    }
+                    else
+                    {
+                        static_assert(always_false<std::remove_cvref_t<Func>>,
+                                      "invalid function object for call to any_of_field");
+                    }
+                });
+            });
+        }
+
+#undef FIELD_RFL_FWD
+
+        // reference to the N-th field, which is an rvalue reference if the object is an rvalue
+        template <std::size_t N, typename T, typename U = std::remove_cvref_t<T>>
+        constexpr decltype(auto) forward_field(std::remove_reference_t<T>& t) noexcept
+        {
+            if constexpr (std::is_rvalue_reference_v<T&&> && !std::is_reference_v<field_type<U, N>>)
+            {
+                return std::move(get_field<N>(t));
+            }
+            else
             {
-                (func(get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)), ...);
+                return get_field<N>(t);
             }
-            else if constexpr (requires {
-                                   (func(field_name<U, Is>, get_stored_field<Is>(storage1),
-                                         get_stored_field<Is>(storage2)),
-                                    ...);
-                               })
+        }
+
+        template <std::size_t N, typename T, typename Func, typename U = std::remove_cvref_t<T>>
+        constexpr void visit_field_at(std::remove_reference_t<T>& t, Func& func)
+        {
+            if constexpr (requires { func(forward_field<N, T>(t)); })
             {
-                (func(field_name<U, Is>, get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)), ...);
+                func(forward_field<N, T>(t));
+            }
+            else if constexpr (requires { func(field_name<U, N>, forward_field<N, T>(t)); })
+            {
+                func(field_name<U, N>, forward_field<N, T>(t));
             }
             else
             {
-                static_assert(always_false<std::remove_cvref_t<Func>>,
-                              "invalid function object for call to for_each_field");
+                static_assert(always_false<Func>, "invalid function object for call to visit_field");
             }
         }
 
-        template <typename T, typename Func, std::size_t... Is, field_referenceable U = std::remove_cvref_t<T>>
-        bool all_of_field_impl(T&& t, Func&& func, std::index_sequence<Is...>)
+        // jump table of the visitors for each field
+        template <typename T, typename Func, typename U = std::remove_cvref_t<T>>
+        constexpr auto visit_field_table = []<std::size_t... Is>(std::index_sequence<Is...>) {
+            using visitor = void (*)(std::remove_reference_t<T>&, Func&);
+            return std::array<visitor, sizeof...(Is)>{&visit_field_at<Is, T, Func>...};
+        }(std::make_index_sequence<field_count<U>>());
+
+        inline std::uint64_t load_u64(const unsigned char* p) noexcept
+        {
+            auto v = std::uint64_t{};
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        constexpr std::uint64_t rotl(std::uint64_t x, int r) noexcept { return (x << r) | (x >> (64 - r)); }
+
+        // xxHash64-like hash with four independent lanes for long inputs
+        inline std::uint64_t hash_bytes(const void* data, std::size_t size) noexcept
         {
-            auto storage = make_field_storage(std::forward<T>(t));
-            if constexpr (requires { (func(get_stored_field<Is>(storage)) && ...); })
+            constexpr auto p1 = std::uint64_t{0x9e3779b185ebca87ULL};
+            constexpr auto p2 = std::uint64_t{0xc2b2ae3d27d4eb4fULL};
+            constexpr auto p3 = std::uint64_t{0x165667b19e3779f9ULL};
+            constexpr auto round = [](std::uint64_t acc, std::uint64_t input) {
+                return rotl(acc + input * p2, 31) * p1;
+            };
+
+            const auto* p = static_cast<const unsigned char*>(data);
+            const auto* const end = p + size;
+            auto h = p3 + size;
+            if (size >= 32)
             {
-                return (func(get_stored_field<Is>(storage)) && ...);
+                std::uint64_t lanes[4] = {p1 + p2, p2, 0, 0 - p1};
+                for (; end - p >= 32; p += 32)
+                {
+                    for (std::size_t i = 0; i < 4; ++i)
+                    {
+                        lanes[i] = round(lanes[i], load_u64(p + i * 8));
+                    }
+                }
+                h = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+                for (const auto lane : lanes)
+                {
+                    h = (h ^ round(0, lane)) * p1 + p3;
+                }
+                h += size;
             }
-            else if constexpr (requires { (func(field_name<U, Is>, get_stored_field<Is>(storage)) && ...); })
+            for (; end - p >= 8; p += 8)
             {
-                return (func(field_name<U, Is>, get_stored_field<Is>(storage)) && ...);
+                h = rotl(h ^ round(0, load_u64(p)), 27) * p1 + p3;
+            }
+            for (; p < end; ++p)
+            {
+                h = rotl(h ^ (*p * p3), 11) * p1;
+            }
+            return mix_hash(h, 0);
+        }
+
+        constexpr std::size_t hash_combine(std::size_t seed, std::size_t h) noexcept
+        {
+            return static_cast<std::size_t>(mix_hash(seed + h, 0));
+        }
+
+        template <field_referenceable T>
+        std::size_t hash_object(const T& t);
+
+        template <typename T>
+        std::size_t hash_value(const T& value)
+        {
+            if constexpr (requires { std::hash<T>{}(value); })
+            {
+                return std::hash<T>{}(value);
+            }
+            else if constexpr (requires { std::tuple_size<T>::value; })
+            {
+                return std::apply(
+                    [](const auto&... elements) {
+                        auto seed = std::size_t{0};
+                        ((seed = hash_combine(seed, hash_value(elements))), ...);
+                        return seed;
+                    },
+                    value);
+            }
+            else if constexpr (requires { std::begin(value) != std::end(value); })
+            {
+                auto seed = std::size_t{0};
+                auto size = std::size_t{0};
+                for (const auto& element : value)
+                {
+                    seed = hash_combine(seed, hash_value(element));
+                    ++size;
+                }
+                return hash_combine(seed, size);
+            }
+            else if constexpr (field_referenceable<T>)
+            {
+                return hash_object(value);
             }
             else
             {
-                static_assert(always_false<std::remove_cvref_t<Func>>,
-                              "invalid function object for call to all_of_field");
+                static_assert(always_false<T>, "field type is not hashable");
             }
         }
 
-        template <typename T1, typename T2, typename Func, std::size_t... Is,
-                  field_referenceable U = std::remove_cvref_t<T1>>
-        bool all_of_field_impl(T1&& t1, T2&& t2, Func&& func, std::index_sequence<Is...>)
+        template <typename T>
+        struct is_optional : std::false_type
         {
-            auto storage1 = make_field_storage(std::forward<T1>(t1));
-            auto storage2 = make_field_storage(std::forward<T2>(t2));
-            if constexpr (requires { (func(get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)) && ...); })
+        };
+
+        template <typename T>
+        struct is_optional<std::optional<T>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        concept tuple_like = requires { std::tuple_size<T>::value; };
+
+        // fields whose equality is the equality of their bytes
+        template <typename T>
+        constexpr bool bitwise_comparable = []() {
+            if constexpr (is_std_array<T>::value)
+            {
+                return std::has_unique_object_representations_v<T> && bitwise_comparable<typename T::value_type>;
+            }
+            else if constexpr (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>)
             {
-                return (func(get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)) && ...);
+                return std::has_unique_object_representations_v<T>;
             }
-            else if constexpr (requires {
-                                   (func(field_name<U, Is>, get_stored_field<Is>(storage1),
-                                         get_stored_field<Is>(storage2)) &&
-                                    ...);
-                               })
+            else if constexpr (field_referenceable<T> && !std::equality_comparable<T>)
+            {
+                return std::has_unique_object_representations_v<T> &&
+                       []<std::size_t... Is>(std::index_sequence<Is...>) {
+                           return (bitwise_comparable<field_type<T, Is>> && ...);
+                       }(std::make_index_sequence<field_count<T>>());
+            }
+            else
+            {
+                return false;
+            }
+        }();
+
+        template <field_referenceable T>
+        std::size_t hash_object(const T& t)
+        {
+            // equal objects have equal bytes unless a field compares by its own operator==
+            if constexpr (std::has_unique_object_representations_v<T> &&
+                          []<std::size_t... Is>(std::index_sequence<Is...>) {
+                              return (bitwise_comparable<field_type<T, Is>> && ...);
+                          }(std::make_index_sequence<field_count<T>>()))
             {
-                return (func(field_name<U, Is>, get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)) && ...);
+                return static_cast<std::size_t>(hash_bytes(std::addressof(t), sizeof(T)));
             }
             else
             {
-                static_assert(always_false<std::remove_cvref_t<Func>>,
-                              "invalid function object for call to all_of_field");
+                auto seed = std::size_t{field_count<T>};
+                for_each_field_impl(t, [&](const auto& field) { seed = hash_combine(seed, hash_value(field)); },
+                                    std::make_index_sequence<field_count<T>>());
+                return seed;
             }
         }
 
-        template <typename T, typename Func, std::size_t... Is, field_referenceable U = std::remove_cvref_t<T>>
-        bool any_of_field_impl(T&& t, Func&& func, std::index_sequence<Is...>)
+        // fields whose order is the lexicographic order of their bytes
+        template <typename T>
+        constexpr bool bitwise_orderable = []() {
+            if constexpr (is_std_array<T>::value)
+            {
+                return std::has_unique_object_representations_v<T> && bitwise_orderable<typename T::value_type>;
+            }
+            else if constexpr (std::is_unsigned_v<T> || std::is_same_v<T, std::byte>)
+            {
+                return std::has_unique_object_representations_v<T> &&
+                       (sizeof(T) == 1 || std::endian::native == std::endian::big);
+            }
+            else
+            {
+                return false;
+            }
+        }();
+
+        // a range of fields [first, last) compared at once over size bytes if bitwise
+        struct field_segment
         {
-            auto storage = make_field_storage(std::forward<T>(t));
-            if constexpr (requires { (func(get_stored_field<Is>(storage)) || ...); })
+            std::size_t first;
+            std::size_t last;
+            std::size_t size;
+            bool bitwise;
+        };
+
+        // merges adjacent fields satisfying Bitwise<F> without padding between them by the derived layout, which
+        // does not depend on the other fields being trivially copyable; a merged run is used at run time only if
+        // layout_verified<T>(), and otherwise falls back to its fields one by one
+        template <field_referenceable T, template <typename> typename Bitwise>
+        constexpr auto make_field_segments()
+        {
+            constexpr auto n = field_count<T>;
+            constexpr auto bitwise = []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return std::array<bool, n>{(field_layoutable<T> && Bitwise<field_type<T, Is>>::value)...};
+            }(std::make_index_sequence<n>());
+
+            auto segments = std::array<field_segment, n>{};
+            auto count = std::size_t{0};
+            for (std::size_t i = 0; i < n; ++i)
             {
-                return (func(get_stored_field<Is>(storage)) || ...);
+                if constexpr (field_layoutable<T>)
+                {
+                    const auto& fields = field_layout_value<T>;
+                    auto& prev = segments[count - (count > 0 ? 1 : 0)];
+                    if (count > 0 && bitwise[i] && prev.bitwise &&
+                        fields[prev.first].offset + prev.size == fields[i].offset)
+                    {
+                        prev.last = i + 1;
+                        prev.size += fields[i].size;
+                        continue;
+                    }
+                    segments[count++] = field_segment{i, i + 1, fields[i].size, bitwise[i]};
+                }
+                else
+                {
+                    segments[count++] = field_segment{i, i + 1, 0, false};
+                }
             }
-            else if constexpr (requires { (func(field_name<U, Is>, get_stored_field<Is>(storage)) || ...); })
+            return std::pair{segments, count};
+        }
+
+        template <typename T>
+        struct bitwise_comparable_trait : std::bool_constant<bitwise_comparable<T>>
+        {
+        };
+
+        template <typename T>
+        struct bitwise_orderable_trait : std::bool_constant<bitwise_orderable<T>>
+        {
+        };
+
+        template <field_referenceable T>
+        constexpr auto equality_segments = make_field_segments<T, bitwise_comparable_trait>();
+
+        template <field_referenceable T>
+        constexpr auto ordering_segments = make_field_segments<T, bitwise_orderable_trait>();
+
+        template <typename T>
+        consteval bool is_field_equality_comparable();
+
+        template <typename T>
+        consteval bool is_field_three_way_comparable();
+
+        template <typename T>
+        concept fields_equality_comparable =
+            field_referenceable<T> && []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return (is_field_equality_comparable<std::remove_reference_t<field_type<T, Is>>>() && ...);
+            }(std::make_index_sequence<field_count<T>>());
+
+        template <typename T>
+        concept fields_three_way_comparable =
+            field_referenceable<T> && []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return (is_field_three_way_comparable<std::remove_reference_t<field_type<T, Is>>>() && ...);
+            }(std::make_index_sequence<field_count<T>>());
+
+        template <typename T>
+        consteval bool is_field_equality_comparable()
+        {
+            return std::equality_comparable<T> || fields_equality_comparable<T>;
+        }
+
+        template <typename T>
+        consteval bool is_field_three_way_comparable()
+        {
+            return std::three_way_comparable<T> || requires(const T& a) { a < a; } || fields_three_way_comparable<T>;
+        }
+
+        template <fields_equality_comparable T>
+        constexpr bool fields_equal(const T& a, const T& b);
+
+        template <fields_three_way_comparable T>
+        constexpr auto fields_compare(const T& a, const T& b);
+
+        template <typename F>
+        constexpr bool field_equal(const F& a, const F& b)
+        {
+            if constexpr (std::equality_comparable<F>)
             {
-                return (func(field_name<U, Is>, get_stored_field<Is>(storage)) || ...);
+                return a == b;
             }
             else
             {
-                static_assert(always_false<std::remove_cvref_t<Func>>,
-                              "invalid function object for call to any_of_field");
+                return fields_equal(a, b);
             }
         }
 
-        template <typename T1, typename T2, typename Func, std::size_t... Is,
-                  field_referenceable U = std::remove_cvref_t<T1>>
-        bool any_of_field_impl(T1&& t1, T2&& t2, Func&& func, std::index_sequence<Is...>)
+        // falls back to a weak ordering synthesized from operator< as the defaulted operator<=> does
+        template <typename F>
+        constexpr auto field_compare(const F& a, const F& b)
+        {
+            if constexpr (std::three_way_comparable<F>)
+            {
+                return a <=> b;
+            }
+            else if constexpr (fields_three_way_comparable<F>)
+            {
+                return fields_compare(a, b);
+            }
+            else
+            {
+                return a < b ? std::weak_ordering::less : b < a ? std::weak_ordering::greater
+                                                                : std::weak_ordering::equivalent;
+            }
+        }
+
+        template <typename T>
+        const unsigned char* field_bytes(const T& field) noexcept
+        {
+            return reinterpret_cast<const unsigned char*>(std::addressof(field));  // NOLINT
+        }
+
+        template <std::size_t S, typename T>
+        constexpr bool segment_equal(const T& a, const T& b)
         {
-            auto storage1 = make_field_storage(std::forward<T1>(t1));
-            auto storage2 = make_field_storage(std::forward<T2>(t2));
-            if constexpr (requires { (func(get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)) || ...); })
+            constexpr auto first = equality_segments<T>.first[S].first;
+            constexpr auto last = equality_segments<T>.first[S].last;
+            if constexpr (equality_segments<T>.first[S].bitwise)
             {
-                return (func(get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)) || ...);
+                if (!std::is_constant_evaluated() && (last - first == 1 || layout_verified<T>()))
+                {
+                    return std::memcmp(field_bytes(get_field<first>(a)), field_bytes(get_field<first>(b)),
+                                       equality_segments<T>.first[S].size) == 0;
+                }
             }
-            else if constexpr (requires {
-                                   (func(field_name<U, Is>, get_stored_field<Is>(storage1),
-                                         get_stored_field<Is>(storage2)) ||
-                                    ...);
-                               })
+            return []<std::size_t... Is>(const T& x, const T& y, std::index_sequence<Is...>) {
+                return (field_equal(get_field<first + Is>(x), get_field<first + Is>(y)) && ...);
+            }(a, b, std::make_index_sequence<last - first>());
+        }
+
+        template <std::size_t S, typename T>
+        constexpr auto segment_compare(const T& a, const T& b)
+        {
+            constexpr auto first = ordering_segments<T>.first[S].first;
+            constexpr auto last = ordering_segments<T>.first[S].last;
+            if constexpr (ordering_segments<T>.first[S].bitwise)
+            {
+                if (!std::is_constant_evaluated() && (last - first == 1 || layout_verified<T>()))
+                {
+                    return std::memcmp(field_bytes(get_field<first>(a)), field_bytes(get_field<first>(b)),
+                                       ordering_segments<T>.first[S].size) <=> 0;
+                }
+                return []<std::size_t... Is>(const T& x, const T& y, std::index_sequence<Is...>) {
+                    auto c = std::strong_ordering::equal;
+                    static_cast<void>(
+                        (((c = field_compare(get_field<first + Is>(x), get_field<first + Is>(y))) != 0) || ...));
+                    return c;
+                }(a, b, std::make_index_sequence<last - first>());
+            }
+            else
+            {
+                return field_compare(get_field<first>(a), get_field<first>(b));
+            }
+        }
+
+        template <fields_equality_comparable T>
+        constexpr bool fields_equal(const T& a, const T& b)
+        {
+            return []<std::size_t... Ss>(const T& x, const T& y, std::index_sequence<Ss...>) {
+                return (segment_equal<Ss>(x, y) && ...);
+            }(a, b, std::make_index_sequence<equality_segments<T>.second>());
+        }
+
+        template <fields_three_way_comparable T>
+        constexpr auto fields_compare(const T& a, const T& b)
+        {
+            return []<std::size_t... Ss>(const T& x, const T& y, std::index_sequence<Ss...>) {
+                using result = std::common_comparison_category_t<decltype(segment_compare<Ss>(x, y))...>;
+                auto c = result{std::strong_ordering::equal};
+                static_cast<void>((((c = segment_compare<Ss>(x, y)) != 0) || ...));
+                return c;
+            }(a, b, std::make_index_sequence<ordering_segments<T>.second>());
+        }
+
+        // members visited by for_each_leaf_field instead of being leaves
+        template <typename T>
+        concept leaf_nestable = field_namable<T> && !tuple_like<T> && !requires(T& t) {
+            std::begin(t);
+            std::end(t);
+        };
+
+        template <typename T>
+        constexpr std::size_t leaf_field_count = []() {
+            if constexpr (leaf_nestable<T>)
             {
-                return (func(field_name<U, Is>, get_stored_field<Is>(storage1), get_stored_field<Is>(storage2)) || ...);
+                return []<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return (leaf_field_count<field_type<T, Is>> + ...);
+                }(std::make_index_sequence<field_count<T>>());
             }
             else
             {
-                static_assert(always_false<std::remove_cvref_t<Func>>,
-                              "invalid function object for call to any_of_field");
+                return std::size_t{1};
+            }
+        }();
+
+        // the flattened index of the first leaf of each field
+        template <field_namable T>
+        constexpr auto first_leaf_index = []<std::size_t... Is>(std::index_sequence<Is...>) {
+            auto result = std::array<std::size_t, field_count<T> + 1>{0, leaf_field_count<field_type<T, Is>>...};
+            for (std::size_t i = 1; i < result.size(); ++i) result[i] += result[i - 1];
+            return result;
+        }(std::make_index_sequence<field_count<T>>());
+
+        template <field_namable T, std::size_t I>
+        constexpr auto leaf_field_owner = []() {
+            auto n = std::size_t{0};
+            while (first_leaf_index<T>[n + 1] <= I) ++n;
+            return n;
+        }();
+
+        template <field_namable T, std::size_t I>
+        struct leaf_path_storage;
+
+        template <field_namable T, std::size_t I>
+        constexpr std::string_view leaf_path = leaf_path_storage<T, I>::value;
+
+        // "name" of a leaf field or "name." followed by the path in the nested struct
+        template <field_namable T, std::size_t I>
+        struct leaf_path_storage
+        {
+            static constexpr auto owner = leaf_field_owner<T, I>;
+            using nested = field_type<T, owner>;
+
+            static constexpr auto chars = []() {
+                constexpr auto name = field_name<T, owner>;
+                if constexpr (leaf_nestable<nested>)
+                {
+                    constexpr auto rest = leaf_path<nested, I - first_leaf_index<T>[owner]>;
+                    auto result = std::array<char, name.size() + 1 + rest.size() + 1>{};
+                    for (std::size_t i = 0; i < name.size(); ++i) result[i] = name[i];
+                    result[name.size()] = '.';
+                    for (std::size_t i = 0; i < rest.size(); ++i) result[name.size() + 1 + i] = rest[i];
+                    return result;
+                }
+                else
+                {
+                    auto result = std::array<char, name.size() + 1>{};
+                    for (std::size_t i = 0; i < name.size(); ++i) result[i] = name[i];
+                    return result;
+                }
+            }();
+
+            static constexpr auto value = std::string_view(chars.data(), chars.size() - 1);
+        };
+
+        template <typename Root, std::size_t First, typename T, typename Func, std::size_t... Is>
+        constexpr void for_each_leaf_field_impl(T&& t, Func& func, std::index_sequence<Is...>)
+        {
+            using U = std::remove_cvref_t<T>;
+            (..., [&]() {
+                using field = field_type<U, Is>;
+                constexpr auto index = First + first_leaf_index<U>[Is];
+                if constexpr (leaf_nestable<field>)
+                {
+                    for_each_leaf_field_impl<Root, index>(forward_field<Is, T>(t), func,
+                                                          std::make_index_sequence<field_count<field>>());
+                }
+                else if constexpr (requires {
+                                       func(leaf_path<Root, index>, std::integral_constant<std::size_t, index>(),
+                                            forward_field<Is, T>(t));
+                                   })
+                {
+                    func(leaf_path<Root, index>, std::integral_constant<std::size_t, index>(),
+                         forward_field<Is, T>(t));
+                }
+                else if constexpr (requires { func(leaf_path<Root, index>, forward_field<Is, T>(t)); })
+                {
+                    func(leaf_path<Root, index>, forward_field<Is, T>(t));
+                }
+                else
+                {
+                    static_assert(always_false<std::remove_cvref_t<Func>>,
+                                  "invalid function object for call to for_each_leaf_field");
+                }
+            }());
+        }
+
+        // continues FNV-1a with the little-endian bytes of the value
+        constexpr std::uint64_t hash_integer(std::uint64_t value, std::uint64_t h) noexcept
+        {
+            for (std::size_t i = 0; i < sizeof(value); ++i)
+            {
+                h ^= (value >> (i * 8)) & 0xff;
+                h *= 1099511628211ULL;
+            }
+            return h;
+        }
+
+        template <typename T>
+        consteval std::uint64_t get_schema_hash()
+        {
+            // names are terminated by NUL so that the boundaries between them are hashed
+            auto h = hash_integer(sizeof(T), hash_name(type_name<T>) * 1099511628211ULL);
+            if constexpr (is_std_array<T>::value)
+            {
+                h = hash_integer(get_schema_hash<typename T::value_type>(), h);
+            }
+            else if constexpr (leaf_nestable<T>)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (..., [&]() {
+                        using field = std::remove_cvref_t<field_type<T, Is>>;
+                        h = hash_name(field_name<T, Is>, h) * 1099511628211ULL;
+                        h = hash_integer(field_layout_value<T>[Is].offset, h);
+                        if constexpr (std::is_reference_v<field_type<T, Is>>)
+                        {
+                            h = hash_name("&", h);
+                        }
+                        h = hash_integer(get_schema_hash<field>(), h);
+                    }());
+                }(std::make_index_sequence<field_count<T>>());
             }
+            return h;
         }
+
+        template <typename T>
+        constexpr std::uint64_t schema_hash = get_schema_hash<std::remove_cv_t<T>>();
     }  // namespace detail
 
     using detail::field_count;
     using detail::field_countable;
+    using detail::fields_compare;
+    using detail::fields_equal;
+    using detail::fields_equality_comparable;
+    using detail::fields_three_way_comparable;
+    using detail::field_index;
+    using detail::field_layout;
+    using detail::field_layoutable;
+    using detail::field_layout_proven;
     using detail::field_namable;
     using detail::field_name;
+    using detail::field_names;
+    using detail::field_offset;
     using detail::field_referenceable;
+    using detail::field_size;
     using detail::field_type;
     using detail::get_field;
+    using detail::has_padding;
+    using detail::layout;
+    using detail::layout_verified;
+    using detail::leaf_field_count;
+    using detail::leaf_path;
+    using detail::npos;
+    using detail::padding_bytes;
+    using detail::schema_hash;
     using detail::to_tuple;
     using detail::type_name;
 
@@ -955,4 +3313,55 @@ namespace field_reflection
         return detail::any_of_field_impl(std::forward<T>(t), std::forward<Func>(func),
                                          std::make_index_sequence<field_count<U>>());
     }
+
+    template <typename T, typename Func, field_namable U = std::remove_cvref_t<T>>
+    constexpr void for_each_leaf_field(T&& t, Func&& func)
+    {
+        detail::for_each_leaf_field_impl<U, 0>(std::forward<T>(t), func, std::make_index_sequence<field_count<U>>());
+    }
+
+    template <typename T, typename Func, field_referenceable U = std::remove_cvref_t<T>>
+    constexpr bool visit_field(T&& t, std::size_t index, Func&& func)
+    {
+        if (index >= field_count<U>) return false;
+        detail::visit_field_table<T, std::remove_reference_t<Func>>[index](t, func);
+        return true;
+    }
+
+    template <typename T, typename Func, field_namable U = std::remove_cvref_t<T>>
+    constexpr bool visit_field(T&& t, std::string_view name, Func&& func)
+    {
+        return visit_field(std::forward<T>(t), field_index<U>(name), std::forward<Func>(func));
+    }
+
+    template <field_referenceable T>
+    std::size_t hash(const T& t)
+    {
+        return detail::hash_object(t);
+    }
+
+    struct hasher
+    {
+        template <field_referenceable T>
+        std::size_t operator()(const T& t) const
+        {
+            return detail::hash_object(t);
+        }
+    };
+
+    // opt-in comparison operators, to be brought into the namespace of the types by using-declarations
+    namespace operators
+    {
+        template <fields_equality_comparable T>
+        constexpr bool operator==(const T& a, const T& b)
+        {
+            return fields_equal(a, b);
+        }
+
+        template <fields_three_way_comparable T>
+        constexpr auto operator<=>(const T& a, const T& b)
+        {
+            return fields_compare(a, b);
+        }
+    }  // namespace operators
 }  // namespace field_reflection
@@ -0,0 +1,180 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include "../field_reflection.hpp"
+#include "parallel.hpp"
+
+namespace field_reflection
+{
+    template <typename T>
+    struct field_summary
+    {
+        using sum_type = std::conditional_t<std::is_floating_point_v<T>, double,
+                                            std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+        T min = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                     : std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                     : std::numeric_limits<T>::lowest();
+        sum_type sum = 0;
+        std::size_t count = 0;
+
+        [[nodiscard]] double mean() const noexcept
+        {
+            return count == 0 ? std::numeric_limits<double>::quiet_NaN()
+                              : static_cast<double>(sum) / static_cast<double>(count);
+        }
+    };
+
+    // min, max, sum and count of each arithmetic field
+    struct summary_reducer
+    {
+        template <typename T>
+        [[nodiscard]] field_summary<T> init() const noexcept
+        {
+            return {};
+        }
+
+        template <typename T>
+        void operator()(field_summary<T>& acc, T value) const noexcept
+        {
+            if (value < acc.min) acc.min = value;
+            if (acc.max < value) acc.max = value;
+            acc.sum += static_cast<typename field_summary<T>::sum_type>(value);
+            ++acc.count;
+        }
+
+        template <typename T>
+        void merge(field_summary<T>& acc, const field_summary<T>& other) const noexcept
+        {
+            if (other.min < acc.min) acc.min = other.min;
+            if (acc.max < other.max) acc.max = other.max;
+            acc.sum += other.sum;
+            acc.count += other.count;
+        }
+    };
+
+    namespace detail
+    {
+        template <typename Field, typename Reducer>
+        struct field_accumulator
+        {
+            using type = std::monostate;
+        };
+
+        template <typename Field, typename Reducer>
+        requires std::is_arithmetic_v<Field>
+        struct field_accumulator<Field, Reducer>
+        {
+            using type = decltype(std::declval<const Reducer&>().template init<Field>());
+        };
+
+        template <typename T, typename Reducer, typename = std::make_index_sequence<field_count<T>>>
+        struct aggregate_result_of;
+
+        template <typename T, typename Reducer, std::size_t... Is>
+        struct aggregate_result_of<T, Reducer, std::index_sequence<Is...>>
+        {
+            using type = std::tuple<typename field_accumulator<std::remove_cv_t<field_type<T, Is>>, Reducer>::type...>;
+        };
+
+        template <typename T, typename Reducer>
+        using aggregate_result = typename aggregate_result_of<T, Reducer>::type;
+
+        template <typename T, typename Reducer>
+        aggregate_result<T, Reducer> init_aggregate(const Reducer& reducer)
+        {
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return aggregate_result<T, Reducer>{[&]() {
+                    using field = std::remove_cv_t<field_type<T, Is>>;
+                    if constexpr (std::is_arithmetic_v<field>)
+                    {
+                        return reducer.template init<field>();
+                    }
+                    else
+                    {
+                        return std::monostate{};
+                    }
+                }()...};
+            }(std::make_index_sequence<field_count<T>>());
+        }
+
+        template <typename T, typename Reducer>
+        void aggregate_rows(std::span<const T> rows, const Reducer& reducer, aggregate_result<T, Reducer>& result)
+        {
+            for (const auto& row : rows)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (..., [&]() {
+                        if constexpr (std::is_arithmetic_v<std::remove_cv_t<field_type<T, Is>>>)
+                        {
+                            reducer(std::get<Is>(result), get_field<Is>(row));
+                        }
+                    }());
+                }(std::make_index_sequence<field_count<T>>());
+            }
+        }
+
+        template <typename T, typename Reducer>
+        void merge_aggregate(const Reducer& reducer, aggregate_result<T, Reducer>& result,
+                             const aggregate_result<T, Reducer>& other)
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (..., [&]() {
+                    if constexpr (std::is_arithmetic_v<std::remove_cv_t<field_type<T, Is>>>)
+                    {
+                        reducer.merge(std::get<Is>(result), std::get<Is>(other));
+                    }
+                }());
+            }(std::make_index_sequence<field_count<T>>());
+        }
+    }  // namespace detail
+
+    template <field_referenceable T, typename Reducer>
+    using aggregate_result = detail::aggregate_result<T, Reducer>;
+
+    // reduces each arithmetic field of the rows; the rows are split into chunks reduced on `threads` threads (0 for
+    // the hardware concurrency) and the partial results are merged in the order of the chunks
+    template <field_referenceable T, typename Reducer = summary_reducer>
+    aggregate_result<T, Reducer> aggregate_fields(std::span<const T> rows, const Reducer& reducer = {},
+                                                  std::size_t threads = 0)
+    {
+        constexpr auto min_rows_per_thread = std::size_t{1} << 14;
+        const auto chunks = detail::worker_count(threads, rows.size(), min_rows_per_thread);
+
+        auto partials = std::vector<aggregate_result<T, Reducer>>(chunks);
+        detail::parallel_chunks(rows.size(), chunks, [&](std::size_t i, std::size_t first, std::size_t last) {
+            // accumulated locally to avoid false sharing between the partial results
+            auto partial = detail::init_aggregate<T>(reducer);
+            detail::aggregate_rows(rows.subspan(first, last - first), reducer, partial);
+            partials[i] = std::move(partial);
+        });
+        for (std::size_t i = 1; i < chunks; ++i) detail::merge_aggregate<T>(reducer, partials[0], partials[i]);
+        return std::move(partials[0]);
+    }
+
+    template <field_referenceable T, typename Reducer = summary_reducer>
+    aggregate_result<T, Reducer> aggregate_fields(std::span<T> rows, const Reducer& reducer = {},
+                                                  std::size_t threads = 0)
+    {
+        return aggregate_fields(std::span<const T>(rows), reducer, threads);
+    }
+}  // namespace field_reflection
@@ -0,0 +1,469 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include "../field_reflection.hpp"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__AVX2__) || defined(__AVX512F__))
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC < 13 warns about the undefined source operand in the AVX-512 intrinsics (GCC bug 105593)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#else
+#include <immintrin.h>
+#endif
+#define FIELD_RFL_COLUMN_SIMD 1
+#endif
+
+namespace field_reflection
+{
+    // random access iterator over the N-th field of consecutive elements
+    template <typename T, std::size_t N>
+    class field_column_iterator
+    {
+        T* ptr_ = nullptr;
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cvref_t<field_type<std::remove_cv_t<T>, N>>;
+        using difference_type = std::ptrdiff_t;
+        using reference = decltype(get_field<N>(std::declval<T&>()));
+
+        field_column_iterator() = default;
+        explicit constexpr field_column_iterator(T* ptr) noexcept : ptr_(ptr) {}
+
+        template <typename U>
+        requires std::is_same_v<const U, T>
+        constexpr field_column_iterator(const field_column_iterator<U, N>& other) noexcept  // NOLINT
+            : ptr_(other.base())
+        {
+        }
+
+        [[nodiscard]] constexpr T* base() const noexcept { return ptr_; }
+
+        constexpr reference operator*() const noexcept { return get_field<N>(*ptr_); }
+        constexpr reference operator[](difference_type n) const noexcept { return get_field<N>(ptr_[n]); }
+
+        constexpr field_column_iterator& operator++() noexcept
+        {
+            ++ptr_;
+            return *this;
+        }
+        constexpr field_column_iterator operator++(int) noexcept
+        {
+            auto it = *this;
+            ++ptr_;
+            return it;
+        }
+        constexpr field_column_iterator& operator--() noexcept
+        {
+            --ptr_;
+            return *this;
+        }
+        constexpr field_column_iterator operator--(int) noexcept
+        {
+            auto it = *this;
+            --ptr_;
+            return it;
+        }
+        constexpr field_column_iterator& operator+=(difference_type n) noexcept
+        {
+            ptr_ += n;
+            return *this;
+        }
+        constexpr field_column_iterator& operator-=(difference_type n) noexcept
+        {
+            ptr_ -= n;
+            return *this;
+        }
+
+        friend constexpr field_column_iterator operator+(field_column_iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+        friend constexpr field_column_iterator operator+(difference_type n, field_column_iterator it) noexcept
+        {
+            return it += n;
+        }
+        friend constexpr field_column_iterator operator-(field_column_iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+        friend constexpr difference_type operator-(const field_column_iterator& a,
+                                                   const field_column_iterator& b) noexcept
+        {
+            return a.ptr_ - b.ptr_;
+        }
+        friend constexpr bool operator==(const field_column_iterator& a, const field_column_iterator& b) noexcept
+        {
+            return a.ptr_ == b.ptr_;
+        }
+        friend constexpr std::strong_ordering operator<=>(const field_column_iterator& a,
+                                                          const field_column_iterator& b) noexcept
+        {
+            return std::compare_three_way()(a.ptr_, b.ptr_);
+        }
+    };
+
+    // view of the N-th field of the elements of a span, stepping sizeof(T) bytes per element
+    template <typename T, std::size_t N>
+    class field_column_view : public std::ranges::view_interface<field_column_view<T, N>>
+    {
+        std::span<T> rows_;
+
+    public:
+        using iterator = field_column_iterator<T, N>;
+
+        field_column_view() = default;
+        explicit constexpr field_column_view(std::span<T> rows) noexcept : rows_(rows) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(rows_.data()); }
+        [[nodiscard]] constexpr iterator end() const noexcept { return iterator(rows_.data() + rows_.size()); }
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return rows_.size(); }
+        [[nodiscard]] constexpr std::span<T> rows() const noexcept { return rows_; }
+    };
+
+    template <std::size_t N, typename T, field_referenceable U = std::remove_cv_t<T>>
+    requires (N < field_count<U>)
+    constexpr field_column_view<T, N> field_column(std::span<T> rows) noexcept
+    {
+        return field_column_view<T, N>(rows);
+    }
+
+    namespace detail
+    {
+#if defined(FIELD_RFL_COLUMN_SIMD)
+        // vectors of the field values gathered from elements `stride` bytes apart
+        template <typename F>
+        struct simd_gather
+        {
+            static constexpr bool supported = false;
+        };
+
+#if defined(__AVX512F__)
+        template <>
+        struct simd_gather<double>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 8;
+            using vector = __m512d;
+            using index = __m512i;
+
+            static index make_index(std::int64_t s) noexcept
+            {
+                return _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+            }
+            static vector gather(const char* p, index i) noexcept { return _mm512_i64gather_pd(i, p, 1); }
+            static vector broadcast(double v) noexcept { return _mm512_set1_pd(v); }
+            static vector add(vector a, vector b) noexcept { return _mm512_add_pd(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm512_min_pd(a, b); }
+            static double sum(vector v) noexcept { return _mm512_reduce_add_pd(v); }
+            static double minimum(vector v) noexcept { return _mm512_reduce_min_pd(v); }
+            static void store(double* out, vector v) noexcept { _mm512_storeu_pd(out, v); }
+        };
+
+        template <>
+        struct simd_gather<float>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 16;
+            using vector = __m512;
+            using index = __m512i;
+
+            static index make_index(std::int32_t s) noexcept
+            {
+                return _mm512_set_epi32(15 * s, 14 * s, 13 * s, 12 * s, 11 * s, 10 * s, 9 * s, 8 * s, 7 * s, 6 * s,
+                                        5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+            }
+            static vector gather(const char* p, index i) noexcept { return _mm512_i32gather_ps(i, p, 1); }
+            static vector broadcast(float v) noexcept { return _mm512_set1_ps(v); }
+            static vector add(vector a, vector b) noexcept { return _mm512_add_ps(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm512_min_ps(a, b); }
+            static float sum(vector v) noexcept { return _mm512_reduce_add_ps(v); }
+            static float minimum(vector v) noexcept { return _mm512_reduce_min_ps(v); }
+            static void store(float* out, vector v) noexcept { _mm512_storeu_ps(out, v); }
+        };
+
+        template <>
+        struct simd_gather<std::int32_t>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 16;
+            using vector = __m512i;
+            using index = __m512i;
+
+            static index make_index(std::int32_t s) noexcept { return simd_gather<float>::make_index(s); }
+            static vector gather(const char* p, index i) noexcept { return _mm512_i32gather_epi32(i, p, 1); }
+            static vector broadcast(std::int32_t v) noexcept { return _mm512_set1_epi32(v); }
+            static vector add(vector a, vector b) noexcept { return _mm512_add_epi32(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm512_min_epi32(a, b); }
+            static std::int32_t sum(vector v) noexcept { return _mm512_reduce_add_epi32(v); }
+            static std::int32_t minimum(vector v) noexcept { return _mm512_reduce_min_epi32(v); }
+            static void store(std::int32_t* out, vector v) noexcept { _mm512_storeu_si512(out, v); }
+        };
+
+        template <>
+        struct simd_gather<std::int64_t>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 8;
+            using vector = __m512i;
+            using index = __m512i;
+
+            static index make_index(std::int64_t s) noexcept { return simd_gather<double>::make_index(s); }
+            static vector gather(const char* p, index i) noexcept { return _mm512_i64gather_epi64(i, p, 1); }
+            static vector broadcast(std::int64_t v) noexcept { return _mm512_set1_epi64(v); }
+            static vector add(vector a, vector b) noexcept { return _mm512_add_epi64(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm512_min_epi64(a, b); }
+            static std::int64_t sum(vector v) noexcept { return _mm512_reduce_add_epi64(v); }
+            static std::int64_t minimum(vector v) noexcept { return _mm512_reduce_min_epi64(v); }
+            static void store(std::int64_t* out, vector v) noexcept { _mm512_storeu_si512(out, v); }
+        };
+#else
+        template <>
+        struct simd_gather<double>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 4;
+            using vector = __m256d;
+            using index = __m256i;
+
+            static index make_index(std::int64_t s) noexcept { return _mm256_set_epi64x(3 * s, 2 * s, s, 0); }
+            static vector gather(const char* p, index i) noexcept
+            {
+                return _mm256_i64gather_pd(reinterpret_cast<const double*>(p), i, 1);
+            }
+            static vector broadcast(double v) noexcept { return _mm256_set1_pd(v); }
+            static vector add(vector a, vector b) noexcept { return _mm256_add_pd(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm256_min_pd(a, b); }
+            static double sum(vector v) noexcept
+            {
+                alignas(32) double lanes[4];
+                _mm256_store_pd(lanes, v);
+                return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+            }
+            static double minimum(vector v) noexcept
+            {
+                alignas(32) double lanes[4];
+                _mm256_store_pd(lanes, v);
+                return std::min({lanes[0], lanes[1], lanes[2], lanes[3]});
+            }
+            static void store(double* out, vector v) noexcept { _mm256_storeu_pd(out, v); }
+        };
+
+        template <>
+        struct simd_gather<float>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 8;
+            using vector = __m256;
+            using index = __m256i;
+
+            static index make_index(std::int32_t s) noexcept
+            {
+                return _mm256_set_epi32(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+            }
+            static vector gather(const char* p, index i) noexcept
+            {
+                return _mm256_i32gather_ps(reinterpret_cast<const float*>(p), i, 1);
+            }
+            static vector broadcast(float v) noexcept { return _mm256_set1_ps(v); }
+            static vector add(vector a, vector b) noexcept { return _mm256_add_ps(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm256_min_ps(a, b); }
+            static float sum(vector v) noexcept
+            {
+                alignas(32) float lanes[8];
+                _mm256_store_ps(lanes, v);
+                return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+                       ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+            }
+            static float minimum(vector v) noexcept
+            {
+                alignas(32) float lanes[8];
+                _mm256_store_ps(lanes, v);
+                return std::min({lanes[0], lanes[1], lanes[2], lanes[3], lanes[4], lanes[5], lanes[6], lanes[7]});
+            }
+            static void store(float* out, vector v) noexcept { _mm256_storeu_ps(out, v); }
+        };
+
+        template <>
+        struct simd_gather<std::int32_t>
+        {
+            static constexpr bool supported = true;
+            static constexpr std::size_t width = 8;
+            using vector = __m256i;
+            using index = __m256i;
+
+            static index make_index(std::int32_t s) noexcept { return simd_gather<float>::make_index(s); }
+            static vector gather(const char* p, index i) noexcept
+            {
+                return _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), i, 1);
+            }
+            static vector broadcast(std::int32_t v) noexcept { return _mm256_set1_epi32(v); }
+            static vector add(vector a, vector b) noexcept { return _mm256_add_epi32(a, b); }
+            static vector min(vector a, vector b) noexcept { return _mm256_min_epi32(a, b); }
+            static std::int32_t sum(vector v) noexcept
+            {
+                alignas(32) std::int32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+                auto result = std::uint32_t{0};
+                for (auto lane : lanes) result += static_cast<std::uint32_t>(lane);
+                return static_cast<std::int32_t>(result);
+            }
+            static std::int32_t minimum(vector v) noexcept
+            {
+                alignas(32) std::int32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+                return *std::min_element(lanes, lanes + 8);
+            }
+            static void store(std::int32_t* out, vector v) noexcept
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+            }
+        };
+#endif
+
+        // the fields are gathered from the address of the field of the first row, so the layout is not needed, but
+        // a reference field is not in the row; the byte offsets of a vector of elements must fit in the gather index
+        template <typename T, std::size_t N, typename F = std::remove_cvref_t<field_type<T, N>>>
+        concept column_gatherable = !std::is_reference_v<field_type<T, N>> && simd_gather<F>::supported &&
+                                    sizeof(T) * simd_gather<F>::width <= std::numeric_limits<std::int32_t>::max();
+
+        // the address of the N-th field of the first row, from which the fields of the rows are sizeof(T) apart
+        template <std::size_t N, typename T>
+        const char* column_base(std::span<T> rows) noexcept
+        {
+            return rows.empty() ? nullptr : reinterpret_cast<const char*>(std::addressof(get_field<N>(rows[0])));
+        }
+#endif
+
+        // field values are gathered in blocks into a contiguous buffer on which the predicate is evaluated, so that
+        // the loop over the buffer can be vectorized by the compiler
+        inline constexpr std::size_t column_block_size = 64;
+    }  // namespace detail
+
+    // sum of the N-th fields with init, in an unspecified order like std::reduce
+    template <std::size_t N, typename T, typename Init = std::remove_cvref_t<field_type<std::remove_cv_t<T>, N>>,
+              field_referenceable U = std::remove_cv_t<T>>
+    Init reduce_field(std::span<T> rows, Init init = {})
+    {
+#if defined(FIELD_RFL_COLUMN_SIMD)
+        using field = std::remove_cvref_t<field_type<U, N>>;
+        if constexpr (detail::column_gatherable<U, N> && std::is_same_v<Init, field>)
+        {
+            using simd = detail::simd_gather<field>;
+            const auto* base = detail::column_base<N>(rows);
+            const auto index = simd::make_index(static_cast<std::int32_t>(sizeof(U)));
+            auto acc = simd::broadcast(field{});
+            auto i = std::size_t{0};
+            for (; i + simd::width <= rows.size(); i += simd::width)
+            {
+                acc = simd::add(acc, simd::gather(base + i * sizeof(U), index));
+            }
+            init += simd::sum(acc);
+            for (; i < rows.size(); ++i) init += get_field<N>(rows[i]);
+            return init;
+        }
+#endif
+        for (const auto& value : field_column<N>(rows)) init += value;
+        return init;
+    }
+
+    // minimum of the N-th fields ignoring NaN, or std::nullopt if there is none
+    template <std::size_t N, typename T, field_referenceable U = std::remove_cv_t<T>>
+    std::optional<std::remove_cvref_t<field_type<U, N>>> min_field(std::span<T> rows)
+    {
+        using field = std::remove_cvref_t<field_type<U, N>>;
+        if (rows.empty()) return std::nullopt;
+
+        // NaN never compares less, so it is skipped unless it is the initial value
+        auto result = field(get_field<N>(rows[0]));
+        if constexpr (std::is_floating_point_v<field>) result = std::numeric_limits<field>::infinity();
+        auto i = std::size_t{0};
+#if defined(FIELD_RFL_COLUMN_SIMD)
+        if constexpr (detail::column_gatherable<U, N>)
+        {
+            using simd = detail::simd_gather<field>;
+            const auto* base = detail::column_base<N>(rows);
+            const auto index = simd::make_index(static_cast<std::int32_t>(sizeof(U)));
+            auto acc = simd::broadcast(result);
+            for (; i + simd::width <= rows.size(); i += simd::width)
+            {
+                // the vector minimum returns the second operand if either is NaN
+                acc = simd::min(simd::gather(base + i * sizeof(U), index), acc);
+            }
+            result = simd::minimum(acc);
+        }
+#endif
+        for (; i < rows.size(); ++i)
+        {
+            if (const auto& value = get_field<N>(rows[i]); value < result) result = value;
+        }
+        if constexpr (std::is_floating_point_v<field>)
+        {
+            if (result == std::numeric_limits<field>::infinity() &&
+                std::ranges::none_of(field_column<N>(rows), [&](const auto& value) { return value == result; }))
+            {
+                return std::nullopt;
+            }
+        }
+        return result;
+    }
+
+    // number of the N-th fields satisfying pred
+    template <std::size_t N, typename T, typename Pred, field_referenceable U = std::remove_cv_t<T>>
+    std::size_t count_if_field(std::span<T> rows, Pred pred)
+    {
+        auto count = std::size_t{0};
+        auto i = std::size_t{0};
+#if defined(FIELD_RFL_COLUMN_SIMD)
+        using field = std::remove_cvref_t<field_type<U, N>>;
+        if constexpr (detail::column_gatherable<U, N> && std::is_invocable_r_v<bool, Pred&, const field&>)
+        {
+            using simd = detail::simd_gather<field>;
+            constexpr auto block = detail::column_block_size;
+            const auto* base = detail::column_base<N>(rows);
+            const auto index = simd::make_index(static_cast<std::int32_t>(sizeof(U)));
+            auto values = std::array<field, block>{};
+            for (; i + block <= rows.size(); i += block)
+            {
+                for (std::size_t j = 0; j < block; j += simd::width)
+                {
+                    simd::store(values.data() + j, simd::gather(base + (i + j) * sizeof(U), index));
+                }
+                auto matches = std::size_t{0};
+                for (const auto& value : values) matches += pred(value) ? 1 : 0;
+                count += matches;
+            }
+        }
+#endif
+        const auto tail = field_column<N>(rows.subspan(i));
+        return count + static_cast<std::size_t>(std::ranges::count_if(tail, std::ref(pred)));
+    }
+}  // namespace field_reflection
+
+#undef FIELD_RFL_COLUMN_SIMD
@@ -0,0 +1,347 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../field_reflection.hpp"
+#include "parallel.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FIELD_RFL_CSV_MMAP 1
+#endif
+
+namespace field_reflection
+{
+    class csv_error : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    struct csv_options
+    {
+        char delimiter = ',';  // '\t' for TSV
+        char quote = '"';
+        bool header = true;       // the first line names the columns, otherwise the columns are the fields in order
+        std::size_t threads = 0;  // 0 for the hardware concurrency
+    };
+
+    namespace detail
+    {
+        // input bytes per thread below which the input is not split further
+        inline constexpr std::size_t csv_min_chunk_size = std::size_t{1} << 20;
+
+        template <typename Container, typename T>
+        concept csv_container = std::is_same_v<typename Container::value_type, T> &&
+                                requires(Container& c, std::size_t n) {
+                                    c.resize(n);
+                                    get_field<0>(c[n]);
+                                };
+
+        // quoted is the quote character if the field is quoted, otherwise '\0'
+        template <typename T>
+        bool parse_csv_value(std::string_view text, char quoted, T& value)
+        {
+            if constexpr (is_optional<T>::value)
+            {
+                if (text.empty() && quoted == '\0')
+                {
+                    value.reset();
+                    return true;
+                }
+                return parse_csv_value(text, quoted, value.emplace());
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                value.assign(text);
+                if (quoted != '\0')
+                {
+                    // a doubled quote in a quoted field is a quote
+                    std::size_t out = 0;
+                    for (std::size_t i = 0; i < value.size(); ++i, ++out)
+                    {
+                        value[out] = value[i];
+                        if (value[i] == quoted && i + 1 < value.size() && value[i + 1] == quoted) ++i;
+                    }
+                    value.resize(out);
+                }
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                if (text == "1" || text == "true")
+                {
+                    value = true;
+                }
+                else if (text == "0" || text == "false")
+                {
+                    value = false;
+                }
+                else
+                {
+                    return false;
+                }
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                if (text.size() != 1) return false;
+                value = text[0];
+                return true;
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                const auto* last = text.data() + text.size();
+                const auto [ptr, ec] = std::from_chars(text.data(), last, value);
+                return ec == std::errc{} && ptr == last;
+            }
+            else
+            {
+                static_assert(always_false<T>, "field type is not readable from CSV");
+            }
+        }
+
+        // splits the next field of a line at pos, which is moved past the delimiter
+        inline std::string_view next_csv_field(std::string_view line, std::size_t& pos, const csv_options& options,
+                                               bool& quoted)
+        {
+            quoted = pos < line.size() && line[pos] == options.quote;
+            if (quoted)
+            {
+                auto end = pos + 1;
+                while (true)
+                {
+                    end = line.find(options.quote, end);
+                    if (end == std::string_view::npos) throw csv_error("unterminated quoted field");
+                    if (end + 1 < line.size() && line[end + 1] == options.quote)
+                    {
+                        end += 2;
+                        continue;
+                    }
+                    break;
+                }
+                const auto field = line.substr(pos + 1, end - pos - 1);
+                pos = end + 1;
+                if (pos < line.size() && line[pos] != options.delimiter)
+                {
+                    throw csv_error("unexpected character after quoted field");
+                }
+                ++pos;
+                return field;
+            }
+
+            const auto end = std::min(line.find(options.delimiter, pos), line.size());
+            const auto field = line.substr(pos, end - pos);
+            pos = end + 1;
+            return field;
+        }
+
+        // calls func for each non-empty line in [first, last) without the line break
+        template <typename Func>
+        void for_each_csv_line(std::string_view input, std::size_t first, std::size_t last, Func&& func)
+        {
+            while (first < last)
+            {
+                const auto* newline = static_cast<const char*>(std::memchr(input.data() + first, '\n', last - first));
+                const auto end = newline != nullptr ? static_cast<std::size_t>(newline - input.data()) : last;
+                auto line = input.substr(first, end - first);
+                if (line.ends_with('\r')) line.remove_suffix(1);
+                if (!line.empty()) func(line);
+                first = end + 1;
+            }
+        }
+
+        // the start of the first line at or after pos
+        inline std::size_t csv_line_start(std::string_view input, std::size_t pos)
+        {
+            if (pos == 0 || pos >= input.size()) return std::min(pos, input.size());
+            const auto* newline = static_cast<const char*>(std::memchr(input.data() + pos - 1, '\n',
+                                                                       input.size() - pos + 1));
+            return newline != nullptr ? static_cast<std::size_t>(newline - input.data()) + 1 : input.size();
+        }
+
+        template <typename T, typename Container>
+        using csv_field_parser = bool (*)(Container&, std::size_t, std::string_view, char);
+
+        template <typename T, typename Container>
+        constexpr auto csv_field_parsers = []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return std::array<csv_field_parser<T, Container>, sizeof...(Is)>{
+                [](Container& c, std::size_t row, std::string_view text, char quoted) {
+                    auto&& r = c[row];
+                    return parse_csv_value(text, quoted, get_field<Is>(r));
+                }...};
+        }(std::make_index_sequence<field_count<T>>());
+
+        template <typename T, typename Container>
+        Container parse_csv(std::string_view input, const csv_options& options)
+        {
+            // the parser of each column, null for the columns of no field
+            auto columns = std::vector<csv_field_parser<T, Container>>{};
+            auto names = std::vector<std::string_view>{};
+            auto body = std::size_t{0};
+            if (options.header)
+            {
+                // the first non-empty line
+                auto header = std::string_view{};
+                while (header.empty() && body < input.size())
+                {
+                    const auto end = std::min(input.find('\n', body), input.size());
+                    header = input.substr(body, end - body);
+                    if (header.ends_with('\r')) header.remove_suffix(1);
+                    body = end + 1;
+                }
+                body = std::min(body, input.size());
+                for (std::size_t pos = 0; pos <= header.size() && !header.empty();)
+                {
+                    auto quoted = false;
+                    const auto name = next_csv_field(header, pos, options, quoted);
+                    const auto index = field_index<T>(name);
+                    columns.push_back(index == npos ? nullptr : csv_field_parsers<T, Container>[index]);
+                    names.push_back(name);
+                }
+            }
+            else
+            {
+                columns.assign(csv_field_parsers<T, Container>.begin(), csv_field_parsers<T, Container>.end());
+                names.assign(field_names<T>.begin(), field_names<T>.end());
+            }
+
+            const auto chunks = worker_count(options.threads, input.size() - body, csv_min_chunk_size);
+            const auto line_start = [&](std::size_t pos) { return csv_line_start(input, body + pos); };
+
+            // count the rows of each chunk to place the rows of the chunks
+            auto offsets = std::vector<std::size_t>(chunks + 1);
+            parallel_chunks(input.size() - body, chunks, [&](std::size_t i, std::size_t first, std::size_t last) {
+                auto count = std::size_t{0};
+                for_each_csv_line(input, line_start(first), line_start(last), [&](std::string_view) { ++count; });
+                offsets[i + 1] = count;
+            });
+            for (std::size_t i = 1; i <= chunks; ++i) offsets[i] += offsets[i - 1];
+
+            auto result = Container{};
+            result.resize(offsets.back());
+            parallel_chunks(input.size() - body, chunks, [&](std::size_t i, std::size_t first, std::size_t last) {
+                auto row = offsets[i];
+                for_each_csv_line(input, line_start(first), line_start(last), [&](std::string_view line) {
+                    auto pos = std::size_t{0};
+                    auto column = std::size_t{0};
+                    for (; column < columns.size() && pos <= line.size(); ++column)
+                    {
+                        auto quoted = false;
+                        auto text = std::string_view{};
+                        try
+                        {
+                            text = next_csv_field(line, pos, options, quoted);
+                        }
+                        catch (const csv_error& e)
+                        {
+                            throw csv_error(std::string(e.what()) + " in row " + std::to_string(row + 1));
+                        }
+                        if (columns[column] != nullptr &&
+                            !columns[column](result, row, text, quoted ? options.quote : '\0'))
+                        {
+                            throw csv_error("invalid value '" + std::string(text) + "' of column " +
+                                            std::string(names[column]) + " in row " + std::to_string(row + 1));
+                        }
+                    }
+                    // every row has exactly the fields of the columns
+                    if (column < columns.size())
+                    {
+                        throw csv_error("missing column " + std::string(names[column]) + " in row " +
+                                        std::to_string(row + 1));
+                    }
+                    if (pos <= line.size())
+                    {
+                        throw csv_error("too many fields in row " + std::to_string(row + 1));
+                    }
+                    ++row;
+                });
+            });
+            return result;
+        }
+    }  // namespace detail
+
+    // parses CSV text to the rows of T matching the columns to the fields by name
+    template <field_namable T, typename Container = std::vector<T>>
+    requires detail::csv_container<Container, T>
+    Container load_csv(std::span<const char> input, const csv_options& options = {})
+    {
+        return detail::parse_csv<T, Container>(std::string_view(input.data(), input.size()), options);
+    }
+
+    template <field_namable T, typename Container = std::vector<T>>
+    requires detail::csv_container<Container, T>
+    Container load_csv(const std::filesystem::path& path, const csv_options& options = {})
+    {
+#if defined(FIELD_RFL_CSV_MMAP)
+        const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) throw std::system_error(errno, std::generic_category(), "load_csv: open");
+        struct stat st = {};
+        if (::fstat(fd, &st) != 0)
+        {
+            const auto error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "load_csv: fstat");
+        }
+        const auto size = static_cast<std::size_t>(st.st_size);
+        if (size == 0)
+        {
+            ::close(fd);
+            return detail::parse_csv<T, Container>({}, options);
+        }
+        auto* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const auto error = errno;
+        ::close(fd);
+        if (data == MAP_FAILED) throw std::system_error(error, std::generic_category(), "load_csv: mmap");
+        ::madvise(data, size, MADV_SEQUENTIAL);
+        try
+        {
+            auto result = detail::parse_csv<T, Container>(std::string_view(static_cast<const char*>(data), size),
+                                                          options);
+            ::munmap(data, size);
+            return result;
+        }
+        catch (...)
+        {
+            ::munmap(data, size);
+            throw;
+        }
+#else
+        auto file = std::ifstream(path, std::ios::binary);
+        if (!file) throw std::system_error(std::make_error_code(std::errc::io_error), "load_csv: open");
+        auto text = std::string(static_cast<std::size_t>(std::filesystem::file_size(path)), '\0');
+        file.read(text.data(), static_cast<std::streamsize>(text.size()));
+        return detail::parse_csv<T, Container>(text, options);
+#endif
+    }
+}  // namespace field_reflection
+
+#undef FIELD_RFL_CSV_MMAP
@@ -0,0 +1,934 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../field_reflection.hpp"
+
+namespace field_reflection
+{
+    namespace detail
+    {
+        template <typename T>
+        concept char_buffer = std::is_same_v<std::ranges::range_value_t<T>, char> &&
+                              requires(T& buffer, const char* p) { buffer.insert(buffer.end(), p, p); };
+
+        template <typename T>
+        concept json_string = std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, std::nullptr_t>;
+
+        template <typename T>
+        concept json_object_range =
+            std::ranges::range<T> && requires(const std::ranges::range_value_t<T>& e) {
+                e.first;
+                e.second;
+                std::tuple_size<std::ranges::range_value_t<T>>::value;
+            } && requires { typename T::key_type; typename T::mapped_type; };
+
+        // {"name0":  ,"name1":  ...  } concatenated in one array with the start of each fragment
+        template <field_namable T>
+        struct json_key_fragments
+        {
+            static constexpr auto count = field_count<T>;
+
+            static constexpr auto size = []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return ((field_name<T, Is>.size() + 4) + ...) + 1;
+            }(std::make_index_sequence<count>());
+
+            static constexpr auto offsets = []() {
+                auto result = std::array<std::size_t, count + 2>{};
+                for (std::size_t i = 0; i < count; ++i) result[i + 1] = result[i] + field_names<T>[i].size() + 4;
+                result[count + 1] = size;
+                return result;
+            }();
+
+            static constexpr auto chars = []() {
+                auto result = std::array<char, size>{};
+                auto p = result.begin();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    *p++ = i == 0 ? '{' : ',';
+                    *p++ = '"';
+                    for (auto c : field_names<T>[i]) *p++ = c;
+                    *p++ = '"';
+                    *p++ = ':';
+                }
+                *p = '}';
+                return result;
+            }();
+
+            template <std::size_t I>
+            static constexpr auto fragment = std::string_view(chars.data() + offsets[I], offsets[I + 1] - offsets[I]);
+        };
+
+        template <typename Buffer>
+        void append(Buffer& out, std::string_view chars)
+        {
+            if constexpr (requires { out.append(chars.data(), chars.size()); })
+            {
+                out.append(chars.data(), chars.size());
+            }
+            else
+            {
+                out.insert(out.end(), chars.data(), chars.data() + chars.size());
+            }
+        }
+
+        template <typename Buffer>
+        void append_json_escaped(Buffer& out, std::string_view str)
+        {
+            constexpr auto hex = std::string_view("0123456789abcdef");
+            auto first = str.begin();
+            for (auto it = str.begin(); it != str.end(); ++it)
+            {
+                const auto c = static_cast<unsigned char>(*it);
+                if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+                append(out, std::string_view(first, it));
+                first = it + 1;
+                switch (c)
+                {
+                    case '"': append(out, "\\\""); break;
+                    case '\\': append(out, "\\\\"); break;
+                    case '\b': append(out, "\\b"); break;
+                    case '\f': append(out, "\\f"); break;
+                    case '\n': append(out, "\\n"); break;
+                    case '\r': append(out, "\\r"); break;
+                    case '\t': append(out, "\\t"); break;
+                    default:
+                    {
+                        const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+                        append(out, std::string_view(escaped, sizeof(escaped)));
+                    }
+                }
+            }
+            append(out, std::string_view(first, str.end()));
+        }
+
+        template <typename Buffer>
+        void write_json_string(Buffer& out, std::string_view str)
+        {
+            append(out, "\"");
+            append_json_escaped(out, str);
+            append(out, "\"");
+        }
+
+        // escapes the characters appended to it into out, to format a map key in place
+        template <typename Buffer>
+        struct json_escaping_buffer
+        {
+            Buffer& out;
+            void append(const char* chars, std::size_t size)
+            {
+                append_json_escaped(out, std::string_view(chars, size));
+            }
+        };
+
+        template <typename Buffer, typename T>
+        void write_json_number(Buffer& out, T value)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                if (!std::isfinite(value)) return append(out, "null");
+            }
+            char buffer[64];
+            const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+            append(out, std::string_view(std::begin(buffer), result.ptr));
+        }
+
+        template <typename Buffer, typename T>
+        void write_json(Buffer& out, const T& value);
+
+        template <typename Buffer, typename T>
+        void write_json_key(Buffer& out, const T& key)
+        {
+            if constexpr (json_string<T>)
+            {
+                write_json_string(out, key);
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                write_json_string(out, std::string_view(&key, 1));
+            }
+            else
+            {
+                // other keys are formatted as values and escaped as a string without a temporary
+                append(out, "\"");
+                auto escaping = json_escaping_buffer<Buffer>{out};
+                write_json(escaping, key);
+                append(out, "\"");
+            }
+        }
+
+        template <typename Buffer, typename T>
+        void write_json(Buffer& out, const T& value)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                append(out, value ? "true" : "false");
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                write_json_string(out, std::string_view(&value, 1));
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                write_json_number(out, value);
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                write_json_number(out, static_cast<std::underlying_type_t<T>>(value));
+            }
+            else if constexpr (std::is_same_v<T, std::nullptr_t> || std::is_same_v<T, std::nullopt_t>)
+            {
+                append(out, "null");
+            }
+            else if constexpr (json_string<T>)
+            {
+                write_json_string(out, value);
+            }
+            else if constexpr (is_optional<T>::value)
+            {
+                if (value.has_value())
+                {
+                    write_json(out, *value);
+                }
+                else
+                {
+                    append(out, "null");
+                }
+            }
+            else if constexpr (json_object_range<T>)
+            {
+                auto separator = std::string_view("{");
+                for (const auto& [k, v] : value)
+                {
+                    append(out, separator);
+                    write_json_key(out, k);
+                    append(out, ":");
+                    write_json(out, v);
+                    separator = ",";
+                }
+                append(out, separator == "{" ? "{}" : "}");
+            }
+            else if constexpr (std::ranges::range<T>)
+            {
+                auto separator = std::string_view("[");
+                for (const std::ranges::range_value_t<T>& e : value)
+                {
+                    append(out, separator);
+                    write_json(out, e);
+                    separator = ",";
+                }
+                append(out, separator == "[" ? "[]" : "]");
+            }
+            else if constexpr (tuple_like<T>)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    append(out, "[");
+                    ((append(out, Is == 0 ? "" : ","), write_json(out, std::get<Is>(value))), ...);
+                    append(out, "]");
+                }(std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (field_namable<T>)
+            {
+                using keys = json_key_fragments<T>;
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ((append(out, keys::template fragment<Is>), write_json(out, get_field<Is>(value))), ...);
+                    append(out, keys::template fragment<keys::count>);
+                }(std::make_index_sequence<keys::count>());
+            }
+            else if constexpr (std::is_empty_v<T> && std::is_aggregate_v<T>)
+            {
+                append(out, "{}");
+            }
+            else
+            {
+                static_assert(always_false<T>, "field type is not convertible to JSON");
+            }
+        }
+    }  // namespace detail
+
+    // appends to the buffer such as std::string or std::vector<char>
+    template <field_namable T, detail::char_buffer Buffer>
+    void to_json(const T& value, Buffer& out)
+    {
+        detail::write_json(out, value);
+    }
+
+    template <field_namable T>
+    std::string to_json(const T& value)
+    {
+        auto out = std::string{};
+        detail::write_json(out, value);
+        return out;
+    }
+
+    class json_error : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    namespace detail
+    {
+        enum class json_token : unsigned char
+        {
+            string,
+            number,
+            true_value,
+            false_value,
+            null,
+            object,
+            array,
+        };
+
+        struct json_ops;
+
+        // the destination of a JSON value; a null target skips the value
+        struct json_slot
+        {
+            void* target = nullptr;
+            const json_ops* ops = nullptr;
+        };
+
+        // type-erased handlers of a destination type, null if the type does not accept the JSON value
+        struct json_ops
+        {
+            void (*scalar)(void* target, json_token kind, std::string_view text) = nullptr;
+            json_slot (*open)(void* target, json_token kind) = nullptr;
+            json_slot (*member)(void* target, std::string_view key) = nullptr;
+            json_slot (*element)(void* target, void* scratch, std::size_t index) = nullptr;
+            void (*commit)(void* target, void* scratch) = nullptr;
+            void (*close)(void* target, std::size_t count) = nullptr;
+            void* (*make_scratch)() = nullptr;
+            void (*free_scratch)(void* scratch) = nullptr;
+        };
+
+        template <typename T>
+        const json_ops* json_ops_of() noexcept;
+
+        template <typename T>
+        json_slot json_slot_of(T& value) noexcept
+        {
+            static_assert(!std::is_const_v<T>, "const field is not readable from JSON");
+            return {std::addressof(value), json_ops_of<T>()};
+        }
+
+        template <typename T>
+        T parse_json_number(std::string_view text)
+        {
+            auto value = T{};
+            const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (ec != std::errc{} || ptr != text.data() + text.size())
+            {
+                throw json_error("invalid number '" + std::string(text) + "'");
+            }
+            return value;
+        }
+
+        inline void expect_json_token(json_token kind, json_token expected, const char* message)
+        {
+            if (kind != expected) throw json_error(message);
+        }
+
+        template <typename T>
+        constexpr json_ops make_json_ops()
+        {
+            auto ops = json_ops{};
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                ops.scalar = [](void* target, json_token kind, std::string_view) {
+                    if (kind != json_token::true_value && kind != json_token::false_value)
+                    {
+                        throw json_error("expected boolean");
+                    }
+                    *static_cast<T*>(target) = kind == json_token::true_value;
+                };
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                ops.scalar = [](void* target, json_token kind, std::string_view text) {
+                    expect_json_token(kind, json_token::string, "expected string");
+                    if (text.size() != 1) throw json_error("expected string of one character");
+                    *static_cast<T*>(target) = text[0];
+                };
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                ops.scalar = [](void* target, json_token kind, std::string_view text) {
+                    expect_json_token(kind, json_token::number, "expected number");
+                    *static_cast<T*>(target) = parse_json_number<T>(text);
+                };
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                ops.scalar = [](void* target, json_token kind, std::string_view text) {
+                    expect_json_token(kind, json_token::number, "expected number");
+                    *static_cast<T*>(target) = static_cast<T>(parse_json_number<std::underlying_type_t<T>>(text));
+                };
+            }
+            else if constexpr (is_optional<T>::value)
+            {
+                using value_type = typename T::value_type;
+                ops.scalar = [](void* target, json_token kind, std::string_view text) {
+                    auto& optional = *static_cast<T*>(target);
+                    if (kind == json_token::null) return optional.reset();
+                    const auto* inner = json_ops_of<value_type>();
+                    if (inner->scalar == nullptr) throw json_error("unexpected scalar value");
+                    inner->scalar(std::addressof(optional.emplace()), kind, text);
+                };
+                ops.open = [](void* target, json_token kind) {
+                    const auto* inner = json_ops_of<value_type>();
+                    if (inner->open == nullptr) throw json_error("unexpected object or array");
+                    return inner->open(std::addressof(static_cast<T*>(target)->emplace()), kind);
+                };
+            }
+            else if constexpr (requires(T& t, std::string_view s) { t = s; })
+            {
+                ops.scalar = [](void* target, json_token kind, std::string_view text) {
+                    expect_json_token(kind, json_token::string, "expected string");
+                    *static_cast<T*>(target) = text;
+                };
+            }
+            else if constexpr (json_object_range<T>)
+            {
+                using key_type = typename T::key_type;
+                ops.open = [](void* target, json_token kind) {
+                    expect_json_token(kind, json_token::object, "expected object");
+                    static_cast<T*>(target)->clear();
+                    return json_slot{target, json_ops_of<T>()};
+                };
+                ops.member = [](void* target, std::string_view key) {
+                    auto& map = *static_cast<T*>(target);
+                    if constexpr (std::is_constructible_v<key_type, std::string_view>)
+                    {
+                        return json_slot_of(map.try_emplace(key_type(key)).first->second);
+                    }
+                    else
+                    {
+                        return json_slot_of(map.try_emplace(parse_json_number<key_type>(key)).first->second);
+                    }
+                };
+            }
+            else if constexpr (is_std_array<T>::value)
+            {
+                ops.open = [](void* target, json_token kind) {
+                    expect_json_token(kind, json_token::array, "expected array");
+                    return json_slot{target, json_ops_of<T>()};
+                };
+                ops.element = [](void* target, void*, std::size_t index) {
+                    if (index >= std::tuple_size_v<T>) throw json_error("too many array elements");
+                    return json_slot_of((*static_cast<T*>(target))[index]);
+                };
+                ops.close = [](void*, std::size_t count) {
+                    if (count != std::tuple_size_v<T>) throw json_error("too few array elements");
+                };
+            }
+            else if constexpr (std::ranges::range<T>)
+            {
+                using element_type = std::ranges::range_value_t<T>;
+                ops.open = [](void* target, json_token kind) {
+                    expect_json_token(kind, json_token::array, "expected array");
+                    static_cast<T*>(target)->clear();
+                    return json_slot{target, json_ops_of<T>()};
+                };
+                if constexpr (requires(T& t) {
+                                  { t.emplace_back() } -> std::same_as<element_type&>;
+                              })
+                {
+                    ops.element = [](void* target, void*, std::size_t) {
+                        return json_slot_of(static_cast<T*>(target)->emplace_back());
+                    };
+                }
+                else
+                {
+                    // elements of sets and proxy containers are read into a scratch value and inserted
+                    ops.element = [](void*, void* scratch, std::size_t) {
+                        auto& element = *static_cast<element_type*>(scratch);
+                        element = element_type{};
+                        return json_slot_of(element);
+                    };
+                    ops.commit = [](void* target, void* scratch) {
+                        auto& container = *static_cast<T*>(target);
+                        container.insert(container.end(), std::move(*static_cast<element_type*>(scratch)));
+                    };
+                    ops.make_scratch = []() -> void* { return new element_type{}; };
+                    ops.free_scratch = [](void* scratch) { delete static_cast<element_type*>(scratch); };
+                }
+            }
+            else if constexpr (tuple_like<T>)
+            {
+                ops.open = [](void* target, json_token kind) {
+                    expect_json_token(kind, json_token::array, "expected array");
+                    return json_slot{target, json_ops_of<T>()};
+                };
+                ops.element = [](void* target, void*, std::size_t index) {
+                    constexpr auto table = []<std::size_t... Is>(std::index_sequence<Is...>) {
+                        return std::array<json_slot (*)(T&), sizeof...(Is)>{
+                            [](T& t) { return json_slot_of(std::get<Is>(t)); }...};
+                    }(std::make_index_sequence<std::tuple_size_v<T>>());
+                    if (index >= table.size()) throw json_error("too many array elements");
+                    return table[index](*static_cast<T*>(target));
+                };
+                ops.close = [](void*, std::size_t count) {
+                    if (count != std::tuple_size_v<T>) throw json_error("too few array elements");
+                };
+            }
+            else if constexpr (field_namable<T>)
+            {
+                ops.open = [](void* target, json_token kind) {
+                    expect_json_token(kind, json_token::object, "expected object");
+                    return json_slot{target, json_ops_of<T>()};
+                };
+                ops.member = [](void* target, std::string_view key) {
+                    constexpr auto table = []<std::size_t... Is>(std::index_sequence<Is...>) {
+                        return std::array<json_slot (*)(T&), sizeof...(Is)>{
+                            [](T& t) { return json_slot_of(get_field<Is>(t)); }...};
+                    }(std::make_index_sequence<field_count<T>>());
+                    const auto index = field_index<T>(key);
+                    return index == npos ? json_slot{} : table[index](*static_cast<T*>(target));
+                };
+            }
+            else
+            {
+                static_assert(always_false<T>, "field type is not readable from JSON");
+            }
+            return ops;
+        }
+
+        template <typename T>
+        const json_ops* json_ops_of() noexcept
+        {
+            static constexpr auto ops = make_json_ops<T>();
+            return &ops;
+        }
+
+        inline void append_utf8(std::string& out, std::uint32_t code)
+        {
+            if (code < 0x80)
+            {
+                out += static_cast<char>(code);
+            }
+            else if (code < 0x800)
+            {
+                out += static_cast<char>(0xc0 | (code >> 6));
+                out += static_cast<char>(0x80 | (code & 0x3f));
+            }
+            else if (code < 0x10000)
+            {
+                out += static_cast<char>(0xe0 | (code >> 12));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (code & 0x3f));
+            }
+            else
+            {
+                out += static_cast<char>(0xf0 | (code >> 18));
+                out += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                out += static_cast<char>(0x80 | (code & 0x3f));
+            }
+        }
+
+        // resumable JSON parser that writes values into the slots without building a document
+        class json_parser
+        {
+            enum class state : unsigned char
+            {
+                value,
+                value_or_end,
+                key,
+                key_or_end,
+                colon,
+                comma_or_end,
+            };
+
+            struct frame
+            {
+                json_slot slot;
+                bool object;
+                state next;
+                std::size_t count = 0;
+                json_slot pending{};
+                bool has_pending = false;
+                std::unique_ptr<void, void (*)(void*)> scratch{nullptr, nullptr};
+            };
+
+            json_slot root_;
+            bool root_done_ = false;
+            std::vector<frame> stack_;
+            std::string pending_;
+            std::string decoded_;
+            std::size_t offset_ = 0;
+
+            [[noreturn]] void fail(std::size_t pos, const std::string& message) const
+            {
+                throw json_error(message + " at offset " + std::to_string(offset_ + pos));
+            }
+
+            static std::size_t skip_whitespace(std::string_view in, std::size_t pos) noexcept
+            {
+                while (pos < in.size() && (in[pos] == ' ' || in[pos] == '\n' || in[pos] == '\r' || in[pos] == '\t'))
+                {
+                    ++pos;
+                }
+                return pos;
+            }
+
+            // returns the end of the string token at pos or npos if incomplete, and its decoded content
+            std::size_t scan_string(std::string_view in, std::size_t pos, std::string_view& content)
+            {
+                auto escaped = false;
+                auto i = pos + 1;
+                for (; i < in.size(); ++i)
+                {
+                    const auto c = static_cast<unsigned char>(in[i]);
+                    if (c == '"') break;
+                    if (c < 0x20) fail(i, "control character in string");
+                    if (c == '\\')
+                    {
+                        escaped = true;
+                        if (++i == in.size()) return npos;
+                    }
+                }
+                if (i == in.size()) return npos;
+
+                content = in.substr(pos + 1, i - pos - 1);
+                if (escaped) content = decode(content, pos + 1);
+                return i + 1;
+            }
+
+            std::string_view decode(std::string_view raw, std::size_t pos)
+            {
+                const auto hex4 = [&](std::size_t i) {
+                    if (i + 4 > raw.size()) fail(pos + i, "invalid unicode escape");
+                    return parse_json_hex(raw.substr(i, 4), pos + i);
+                };
+
+                decoded_.clear();
+                for (std::size_t i = 0; i < raw.size(); ++i)
+                {
+                    if (raw[i] != '\\')
+                    {
+                        decoded_ += raw[i];
+                        continue;
+                    }
+                    switch (raw[++i])
+                    {
+                        case '"': decoded_ += '"'; break;
+                        case '\\': decoded_ += '\\'; break;
+                        case '/': decoded_ += '/'; break;
+                        case 'b': decoded_ += '\b'; break;
+                        case 'f': decoded_ += '\f'; break;
+                        case 'n': decoded_ += '\n'; break;
+                        case 'r': decoded_ += '\r'; break;
+                        case 't': decoded_ += '\t'; break;
+                        case 'u':
+                        {
+                            auto code = hex4(i + 1);
+                            i += 4;
+                            if (code >= 0xd800 && code < 0xdc00 && raw.substr(i + 1, 2) == "\\u")
+                            {
+                                const auto low = hex4(i + 3);
+                                if (low >= 0xdc00 && low < 0xe000)
+                                {
+                                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                                    i += 6;
+                                }
+                            }
+                            append_utf8(decoded_, code);
+                            break;
+                        }
+                        default: fail(pos + i, "invalid escape sequence");
+                    }
+                }
+                return decoded_;
+            }
+
+            std::uint32_t parse_json_hex(std::string_view text, std::size_t pos) const
+            {
+                auto code = std::uint32_t{};
+                const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), code, 16);
+                if (ec != std::errc{} || ptr != text.data() + text.size()) fail(pos, "invalid unicode escape");
+                return code;
+            }
+
+            json_slot& value_slot()
+            {
+                if (stack_.empty()) return root_;
+                auto& top = stack_.back();
+                if (!top.object && !top.has_pending)
+                {
+                    top.pending = top.slot.target == nullptr
+                                      ? json_slot{}
+                                      : top.slot.ops->element(top.slot.target, top.scratch.get(), top.count);
+                    top.has_pending = true;
+                }
+                return top.pending;
+            }
+
+            void value_done()
+            {
+                if (stack_.empty())
+                {
+                    root_done_ = true;
+                    return;
+                }
+                auto& top = stack_.back();
+                if (!top.object && top.slot.target != nullptr && top.slot.ops->commit != nullptr)
+                {
+                    top.slot.ops->commit(top.slot.target, top.scratch.get());
+                }
+                ++top.count;
+                top.has_pending = false;
+                top.next = state::comma_or_end;
+            }
+
+            void scalar(std::size_t pos, json_token kind, std::string_view text)
+            {
+                const auto slot = value_slot();
+                if (slot.target != nullptr)
+                {
+                    if (slot.ops->scalar == nullptr) fail(pos, "unexpected scalar value");
+                    slot.ops->scalar(slot.target, kind, text);
+                }
+                value_done();
+            }
+
+            void open(std::size_t pos, json_token kind)
+            {
+                const auto slot = value_slot();
+                auto f = frame{{}, kind == json_token::object, kind == json_token::object ? state::key_or_end
+                                                                                          : state::value_or_end};
+                if (slot.target != nullptr)
+                {
+                    if (slot.ops->open == nullptr) fail(pos, "unexpected object or array");
+                    f.slot = slot.ops->open(slot.target, kind);
+                    if (f.slot.ops->make_scratch != nullptr)
+                    {
+                        f.scratch = {f.slot.ops->make_scratch(), f.slot.ops->free_scratch};
+                    }
+                }
+                stack_.push_back(std::move(f));
+            }
+
+            void close()
+            {
+                auto& top = stack_.back();
+                if (top.slot.target != nullptr && top.slot.ops->close != nullptr)
+                {
+                    top.slot.ops->close(top.slot.target, top.count);
+                }
+                stack_.pop_back();
+                value_done();
+            }
+
+            // parses complete tokens and returns the number of characters consumed
+            std::size_t parse(std::string_view in, bool last)
+            {
+                auto pos = std::size_t{0};
+                while ((pos = skip_whitespace(in, pos)) < in.size())
+                {
+                    if (root_done_) fail(pos, "unexpected character after the value");
+
+                    const auto c = in[pos];
+                    const auto next = stack_.empty() ? state::value : stack_.back().next;
+                    if (next == state::value || next == state::value_or_end)
+                    {
+                        if (next == state::value_or_end && c == ']')
+                        {
+                            close();
+                            ++pos;
+                        }
+                        else if (c == '{' || c == '[')
+                        {
+                            open(pos, c == '{' ? json_token::object : json_token::array);
+                            ++pos;
+                        }
+                        else if (c == '"')
+                        {
+                            auto content = std::string_view();
+                            const auto end = scan_string(in, pos, content);
+                            if (end == npos)
+                            {
+                                if (last) fail(pos, "unterminated string");
+                                return pos;
+                            }
+                            scalar(pos, json_token::string, content);
+                            pos = end;
+                        }
+                        else if (c == 't' || c == 'f' || c == 'n')
+                        {
+                            const auto literal = std::string_view(c == 't' ? "true" : c == 'f' ? "false" : "null");
+                            const auto token = in.substr(pos, literal.size());
+                            if (!literal.starts_with(token)) fail(pos, "invalid literal");
+                            if (token.size() < literal.size())
+                            {
+                                if (last) fail(pos, "invalid literal");
+                                return pos;
+                            }
+                            scalar(pos,
+                                   c == 't'   ? json_token::true_value
+                                   : c == 'f' ? json_token::false_value
+                                              : json_token::null,
+                                   token);
+                            pos += literal.size();
+                        }
+                        else if (c == '-' || (c >= '0' && c <= '9'))
+                        {
+                            const auto end = in.find_first_not_of("0123456789+-.eE", pos);
+                            if (end == std::string_view::npos && !last) return pos;
+                            const auto token = in.substr(pos, end - pos);
+                            scalar(pos, json_token::number, token);
+                            pos += token.size();
+                        }
+                        else
+                        {
+                            fail(pos, std::string("unexpected character '") + c + "'");
+                        }
+                        continue;
+                    }
+
+                    auto& top = stack_.back();
+                    switch (next)
+                    {
+                        case state::key_or_end:
+                            if (c == '}')
+                            {
+                                close();
+                                ++pos;
+                                break;
+                            }
+                            [[fallthrough]];
+                        case state::key:
+                        {
+                            if (c != '"') fail(pos, "expected key");
+                            auto key = std::string_view();
+                            const auto end = scan_string(in, pos, key);
+                            if (end == npos)
+                            {
+                                if (last) fail(pos, "unterminated string");
+                                return pos;
+                            }
+                            top.pending = top.slot.target == nullptr ? json_slot{}
+                                                                     : top.slot.ops->member(top.slot.target, key);
+                            top.next = state::colon;
+                            pos = end;
+                            break;
+                        }
+                        case state::colon:
+                            if (c != ':') fail(pos, "expected ':'");
+                            top.next = state::value;
+                            ++pos;
+                            break;
+                        case state::comma_or_end:
+                            if (c == ',')
+                            {
+                                top.next = top.object ? state::key : state::value;
+                            }
+                            else if (c == (top.object ? '}' : ']'))
+                            {
+                                close();
+                            }
+                            else
+                            {
+                                fail(pos, top.object ? "expected ',' or '}'" : "expected ',' or ']'");
+                            }
+                            ++pos;
+                            break;
+                        case state::value:
+                        case state::value_or_end:
+                        default: break;
+                    }
+                }
+                return pos;
+            }
+
+        public:
+            explicit json_parser(json_slot root) noexcept : root_(root) {}
+
+            [[nodiscard]] bool done() const noexcept { return root_done_; }
+
+            void feed(std::string_view chunk)
+            {
+                if (pending_.empty())
+                {
+                    const auto consumed = parse(chunk, false);
+                    offset_ += consumed;
+                    pending_.assign(chunk.substr(consumed));
+                }
+                else
+                {
+                    // a token split between chunks is parsed again from its beginning
+                    pending_.append(chunk);
+                    const auto consumed = parse(pending_, false);
+                    offset_ += consumed;
+                    pending_.erase(0, consumed);
+                }
+            }
+
+            void finish()
+            {
+                offset_ += parse(pending_, true);
+                pending_.clear();
+                if (!root_done_) fail(0, "unexpected end of input");
+            }
+        };
+    }  // namespace detail
+
+    // reads a JSON object into a field_namable object from chunks of input as they arrive
+    template <field_namable T>
+    class json_reader
+    {
+        detail::json_parser parser_;
+
+    public:
+        explicit json_reader(T& value) : parser_(detail::json_slot_of(value)) {}
+
+        // parses the complete tokens of the chunk and keeps the rest for the next one
+        void feed(std::string_view chunk) { parser_.feed(chunk); }
+
+        // parses the remaining input and throws json_error unless the value is complete
+        void finish() { parser_.finish(); }
+
+        [[nodiscard]] bool done() const noexcept { return parser_.done(); }
+    };
+
+    template <field_namable T>
+    void from_json(std::string_view json, T& value)
+    {
+        auto reader = json_reader<T>(value);
+        reader.feed(json);
+        reader.finish();
+    }
+
+    template <field_namable T>
+    T from_json(std::string_view json)
+    {
+        auto value = T{};
+        from_json(json, value);
+        return value;
+    }
+}  // namespace field_reflection
@@ -0,0 +1,341 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "mapped_records requires POSIX mmap"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../field_reflection.hpp"
+#include "schema.hpp"
+#include "serialization.hpp"
+
+namespace field_reflection
+{
+    namespace detail
+    {
+        // the file consists of this header, the serialized record_schema, padding, and the records
+        struct record_file_header
+        {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t byte_order;
+            std::uint64_t data_offset;
+            std::uint64_t schema_size;
+        };
+
+        inline constexpr auto record_file_magic = std::array<char, 8>{'F', 'R', 'F', 'L', 'R', 'E', 'C', '\0'};
+        inline constexpr std::uint32_t record_file_version = 2;  // 2: schema_hash of the record and the fields
+        inline constexpr std::uint32_t record_file_byte_order = 0x01020304;
+
+        // records start at a cache line boundary of the mapping, which is page aligned
+        inline constexpr std::size_t record_file_alignment = 64;
+
+        [[noreturn]] inline void throw_errno(const char* what)
+        {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        inline void write_all(int fd, const void* data, std::size_t size, std::uint64_t offset)
+        {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            while (size > 0)
+            {
+                const auto written = ::pwrite(fd, bytes, size, static_cast<off_t>(offset));
+                if (written < 0)
+                {
+                    if (errno == EINTR) continue;
+                    throw_errno("mapped_records: write");
+                }
+                bytes += written;
+                size -= static_cast<std::size_t>(written);
+                offset += static_cast<std::uint64_t>(written);
+            }
+        }
+
+        // the stored schema and the offset of the records
+        inline std::pair<record_schema, std::uint64_t> read_record_file_header(std::span<const std::byte> file,
+                                                                               const std::string& what)
+        {
+            auto header = record_file_header{};
+            if (file.size() < sizeof(header)) throw std::runtime_error(what + ": file is too small");
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (header.magic != record_file_magic) throw std::runtime_error(what + ": not a record file");
+            if (header.version != record_file_version)
+            {
+                throw std::runtime_error(what + ": unsupported file version");
+            }
+            if (header.byte_order != record_file_byte_order)
+            {
+                throw std::runtime_error(what + ": byte order of the file differs");
+            }
+            if (header.schema_size > file.size() - sizeof(header) || header.data_offset > file.size() ||
+                header.data_offset < sizeof(header) + header.schema_size)
+            {
+                throw std::runtime_error(what + ": corrupted header");
+            }
+            return {deserialize<record_schema>(file.subspan(sizeof(header), header.schema_size)), header.data_offset};
+        }
+
+        struct file_descriptor
+        {
+            int fd = -1;
+            ~file_descriptor()
+            {
+                if (fd >= 0) ::close(fd);
+            }
+        };
+
+        struct memory_map
+        {
+            void* data = MAP_FAILED;
+            std::size_t size = 0;
+            ~memory_map()
+            {
+                if (data != MAP_FAILED) ::munmap(data, size);
+            }
+        };
+    }  // namespace detail
+
+    enum class record_file_mode
+    {
+        read,    // open an existing file read-only
+        append,  // open an existing file for appending, or create it
+        create,  // create a file, truncating an existing one
+    };
+
+    // the records are stored with the offsets of layout<T>, which must be verified at compile time
+    template <typename T>
+    concept mappable_record = field_namable<T> && field_layout_proven<T> && std::is_trivially_copyable_v<T>;
+
+    // file of fixed-size records of T mapped into memory
+    template <mappable_record T>
+    class mapped_records
+    {
+        int fd_ = -1;
+        bool writable_ = false;
+        std::byte* map_ = nullptr;
+        std::size_t map_size_ = 0;
+        std::uint64_t data_offset_ = 0;
+        std::size_t size_ = 0;
+        record_schema schema_;
+
+        void unmap() noexcept
+        {
+            if (map_ != nullptr) ::munmap(map_, map_size_);
+            map_ = nullptr;
+            map_size_ = 0;
+        }
+
+        void close() noexcept
+        {
+            unmap();
+            if (fd_ >= 0) ::close(fd_);
+            fd_ = -1;
+        }
+
+        void map(std::size_t file_size)
+        {
+            unmap();
+            auto* map = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd_, 0);
+            if (map == MAP_FAILED) detail::throw_errno("mapped_records: mmap");
+            map_ = static_cast<std::byte*>(map);
+            map_size_ = file_size;
+        }
+
+        void initialize()
+        {
+            schema_ = make_record_schema<T>();
+            const auto schema = serialize(schema_);
+            const auto header_size = sizeof(detail::record_file_header) + schema.size();
+            constexpr auto alignment = std::max(alignof(T), detail::record_file_alignment);
+            const auto header = detail::record_file_header{
+                detail::record_file_magic, detail::record_file_version, detail::record_file_byte_order,
+                (header_size + alignment - 1) / alignment * alignment, schema.size()};
+            data_offset_ = header.data_offset;
+
+            auto bytes = std::vector<std::byte>(data_offset_);
+            std::memcpy(bytes.data(), &header, sizeof(header));
+            std::memcpy(bytes.data() + sizeof(header), schema.data(), schema.size());
+            if (::ftruncate(fd_, 0) != 0) detail::throw_errno("mapped_records: ftruncate");
+            detail::write_all(fd_, bytes.data(), bytes.size(), 0);
+            map(bytes.size());
+        }
+
+        void validate(std::size_t file_size)
+        {
+            // mmap of an empty file fails, so a short file is rejected before mapping
+            if (file_size < sizeof(detail::record_file_header))
+            {
+                throw std::runtime_error("mapped_records: file is too small");
+            }
+            map(file_size);
+            auto [schema, data_offset] =
+                detail::read_record_file_header(std::span<const std::byte>(map_, file_size), "mapped_records");
+            if (data_offset % alignof(T) != 0) throw std::runtime_error("mapped_records: corrupted header");
+            if (const auto difference = detail::schema_difference(schema, make_record_schema<T>());
+                !difference.empty())
+            {
+                throw std::runtime_error("mapped_records: schema mismatch: " + difference);
+            }
+            schema_ = std::move(schema);
+            data_offset_ = data_offset;
+        }
+
+    public:
+        using value_type = T;
+        using iterator = typename std::span<const T>::iterator;
+
+        mapped_records() = default;
+
+        explicit mapped_records(const std::filesystem::path& path, record_file_mode mode = record_file_mode::read)
+            : writable_(mode != record_file_mode::read)
+        {
+            const auto flags = mode == record_file_mode::read     ? O_RDONLY
+                               : mode == record_file_mode::append ? O_RDWR | O_CREAT
+                                                                  : O_RDWR | O_CREAT | O_TRUNC;
+            fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+            if (fd_ < 0) detail::throw_errno("mapped_records: open");
+
+            try
+            {
+                struct stat st = {};
+                if (::fstat(fd_, &st) != 0) detail::throw_errno("mapped_records: fstat");
+                const auto file_size = static_cast<std::size_t>(st.st_size);
+                if (mode != record_file_mode::read && file_size == 0)
+                {
+                    initialize();
+                    return;
+                }
+
+                validate(file_size);
+                size_ = (file_size - data_offset_) / sizeof(T);
+
+                // drop a partially written record at the end
+                const auto used = data_offset_ + size_ * sizeof(T);
+                if (writable_ && used != file_size && ::ftruncate(fd_, static_cast<off_t>(used)) != 0)
+                {
+                    detail::throw_errno("mapped_records: ftruncate");
+                }
+            }
+            catch (...)
+            {
+                close();
+                throw;
+            }
+        }
+
+        mapped_records(const mapped_records&) = delete;
+        mapped_records& operator=(const mapped_records&) = delete;
+
+        mapped_records(mapped_records&& other) noexcept
+            : fd_(std::exchange(other.fd_, -1)),
+              writable_(std::exchange(other.writable_, false)),
+              map_(std::exchange(other.map_, nullptr)),
+              map_size_(std::exchange(other.map_size_, 0)),
+              data_offset_(std::exchange(other.data_offset_, 0)),
+              size_(std::exchange(other.size_, 0)),
+              schema_(std::move(other.schema_))
+        {
+        }
+
+        mapped_records& operator=(mapped_records&& other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                fd_ = std::exchange(other.fd_, -1);
+                writable_ = std::exchange(other.writable_, false);
+                map_ = std::exchange(other.map_, nullptr);
+                map_size_ = std::exchange(other.map_size_, 0);
+                data_offset_ = std::exchange(other.data_offset_, 0);
+                size_ = std::exchange(other.size_, 0);
+                schema_ = std::move(other.schema_);
+            }
+            return *this;
+        }
+
+        ~mapped_records() { close(); }
+
+        // the records are remapped after each append, so append in batches and do not keep the previous span
+        void append(std::span<const T> records)
+        {
+            if (!writable_) throw std::logic_error("mapped_records: file is opened read-only");
+            if (records.empty()) return;
+            const auto end = data_offset_ + size_ * sizeof(T);
+            detail::write_all(fd_, records.data(), records.size_bytes(), end);
+            size_ += records.size();
+            map(static_cast<std::size_t>(end + records.size_bytes()));
+        }
+
+        void append(const T& record) { append(std::span<const T>(&record, 1)); }
+
+        void flush()
+        {
+            if (fd_ >= 0 && ::fsync(fd_) != 0) detail::throw_errno("mapped_records: fsync");
+        }
+
+        [[nodiscard]] std::span<const T> records() const noexcept
+        {
+            if (size_ == 0) return {};
+            return std::span<const T>(reinterpret_cast<const T*>(map_ + data_offset_), size_);  // NOLINT
+        }
+
+        [[nodiscard]] const record_schema& schema() const noexcept { return schema_; }
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+        [[nodiscard]] const T& operator[](std::size_t i) const noexcept { return records()[i]; }
+        [[nodiscard]] iterator begin() const noexcept { return records().begin(); }
+        [[nodiscard]] iterator end() const noexcept { return records().end(); }
+    };
+
+    // reads a record file of the same or an older schema, converting the records to T by the field names
+    template <mappable_record T>
+    std::vector<T> read_records(const std::filesystem::path& path)
+    {
+        auto file = detail::file_descriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (file.fd < 0) detail::throw_errno("read_records: open");
+        struct stat st = {};
+        if (::fstat(file.fd, &st) != 0) detail::throw_errno("read_records: fstat");
+
+        auto map = detail::memory_map{};
+        map.size = static_cast<std::size_t>(st.st_size);
+        if (map.size > 0) map.data = ::mmap(nullptr, map.size, PROT_READ, MAP_PRIVATE, file.fd, 0);
+        if (map.data == MAP_FAILED)
+        {
+            if (map.size > 0) detail::throw_errno("read_records: mmap");
+            throw std::runtime_error("read_records: file is too small");
+        }
+
+        const auto bytes = std::span(static_cast<const std::byte*>(map.data), map.size);
+        const auto [schema, data_offset] = detail::read_record_file_header(bytes, "read_records");
+        return record_converter<T>(schema).convert_all(bytes.subspan(static_cast<std::size_t>(data_offset)));
+    }
+}  // namespace field_reflection
@@ -0,0 +1,66 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace field_reflection
+{
+    namespace detail
+    {
+        // number of worker threads for the requested count (0 for the hardware concurrency) and the amount of work
+        inline std::size_t worker_count(std::size_t requested, std::size_t work, std::size_t min_work_per_thread)
+        {
+            const auto hardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+            const auto threads = requested != 0 ? requested : std::max<std::size_t>(hardware, 1);
+            return std::clamp<std::size_t>(work / std::max<std::size_t>(min_work_per_thread, 1), 1, threads);
+        }
+
+        // calls func(index, first, last) for `chunks` contiguous chunks of [0, size) on as many threads, the first of
+        // which runs on the calling thread; the first exception thrown by func is rethrown after all chunks finish
+        template <typename Func>
+        void parallel_chunks(std::size_t size, std::size_t chunks, Func&& func)
+        {
+            const auto bound = [&](std::size_t i) { return size / chunks * i + std::min(i, size % chunks); };
+            if (chunks <= 1)
+            {
+                func(std::size_t{0}, std::size_t{0}, size);
+                return;
+            }
+
+            auto errors = std::vector<std::exception_ptr>(chunks);
+            const auto run = [&](std::size_t i) {
+                try
+                {
+                    func(i, bound(i), bound(i + 1));
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            };
+            {
+                auto workers = std::vector<std::jthread>();
+                workers.reserve(chunks - 1);
+                for (std::size_t i = 1; i < chunks; ++i) workers.emplace_back(run, i);
+                run(0);
+            }
+            for (const auto& error : errors)
+            {
+                if (error) std::rethrow_exception(error);
+            }
+        }
+    }  // namespace detail
+}  // namespace field_reflection
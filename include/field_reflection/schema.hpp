@@ -0,0 +1,303 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../field_reflection.hpp"
+
+namespace field_reflection
+{
+    struct field_schema
+    {
+        std::string name;
+        std::string type_name;
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint64_t hash;  // schema_hash of the type
+
+        friend bool operator==(const field_schema&, const field_schema&) = default;
+    };
+
+    // layout of a type to be stored with its binary records
+    struct record_schema
+    {
+        std::string type_name;
+        std::uint64_t size;
+        std::uint64_t alignment;
+        std::uint64_t hash;  // schema_hash<T>, which also covers the nested types
+        std::vector<field_schema> fields;
+
+        friend bool operator==(const record_schema&, const record_schema&) = default;
+    };
+
+    template <field_namable T>
+    requires field_layoutable<T>
+    record_schema make_record_schema()
+    {
+        if (!layout_verified<T>()) throw std::runtime_error("make_record_schema: layout of the type is not verified");
+        auto schema = record_schema{std::string(type_name<T>), sizeof(T), alignof(T), schema_hash<T>, {}};
+        schema.fields.reserve(field_count<T>);
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (schema.fields.push_back(field_schema{
+                 std::string(field_name<T, Is>), std::string(type_name<std::remove_cvref_t<field_type<T, Is>>>),
+                 field_offset<T, Is>, field_size<T, Is>, schema_hash<std::remove_cvref_t<field_type<T, Is>>>}),
+             ...);
+        }(std::make_index_sequence<field_count<T>>());
+        return schema;
+    }
+
+    namespace detail
+    {
+        // the first difference between the schemas, or an empty string if they are equal
+        inline std::string schema_difference(const record_schema& stored, const record_schema& expected)
+        {
+            if (stored.type_name != expected.type_name)
+            {
+                return "type " + stored.type_name + " is not " + expected.type_name;
+            }
+            if (stored.size != expected.size || stored.alignment != expected.alignment)
+            {
+                return "size or alignment of " + stored.type_name + " differs";
+            }
+            if (stored.fields.size() != expected.fields.size())
+            {
+                return "number of fields of " + stored.type_name + " differs";
+            }
+            for (std::size_t i = 0; i < stored.fields.size(); ++i)
+            {
+                const auto& s = stored.fields[i];
+                const auto& e = expected.fields[i];
+                if (s.name != e.name) return "field " + std::to_string(i) + " is " + s.name + ", not " + e.name;
+                if (s != e) return "type or layout of field " + s.name + " differs";
+            }
+            if (stored.hash != expected.hash) return "schema of a nested type of " + stored.type_name + " differs";
+            return {};
+        }
+
+        // the field types that a stored field can be converted from, identified by the type name and the size
+        using convertible_field_types =
+            std::tuple<bool, char, signed char, unsigned char, wchar_t, char8_t, char16_t, char32_t, short,
+                       unsigned short, int, unsigned int, long, unsigned long, long long, unsigned long long, float,
+                       double, long double>;
+
+        // a floating-point value out of the range of an integer is clamped to it, and NaN is zero, as static_cast
+        // of them is undefined; the bounds of integers are powers of two that are exact in floating-point types
+        template <typename From, typename To>
+        void convert_field(const std::byte* source, std::byte* target) noexcept
+        {
+            auto from = From{};
+            std::memcpy(&from, source, sizeof(From));
+            auto to = To{};
+            if constexpr (std::is_floating_point_v<From> && std::is_integral_v<To> && !std::is_same_v<To, bool>)
+            {
+                if (std::isnan(from))
+                {
+                    to = To{0};
+                }
+                else if (from <= static_cast<From>(std::numeric_limits<To>::lowest()))
+                {
+                    to = std::numeric_limits<To>::lowest();
+                }
+                else if (from >= static_cast<From>(std::numeric_limits<To>::max()))
+                {
+                    to = std::numeric_limits<To>::max();
+                }
+                else
+                {
+                    to = static_cast<To>(from);
+                }
+            }
+            else
+            {
+                to = static_cast<To>(from);
+            }
+            std::memcpy(target, &to, sizeof(To));
+        }
+
+        template <typename To>
+        auto find_field_converter(const field_schema& stored) noexcept
+        {
+            auto result = static_cast<void (*)(const std::byte*, std::byte*) noexcept>(nullptr);
+            if constexpr (std::is_arithmetic_v<To>)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (..., [&]() {
+                        using from = std::tuple_element_t<Is, convertible_field_types>;
+                        if (stored.type_name == type_name<from> && stored.size == sizeof(from))
+                        {
+                            result = &convert_field<from, To>;
+                        }
+                    }());
+                }(std::make_index_sequence<std::tuple_size_v<convertible_field_types>>());
+            }
+            return result;
+        }
+    }  // namespace detail
+
+    enum class conversion_kind
+    {
+        copy,           // bytes copied as they are, possibly over several fields
+        convert,        // arithmetic value converted by static_cast, clamped from floating-point to integers
+        default_value,  // field missing in the stored schema, left as in a value-initialized T
+    };
+
+    struct conversion_step
+    {
+        conversion_kind kind;
+        std::size_t source_offset;
+        std::size_t target_offset;
+        std::size_t size;  // bytes to copy, or the size of the target field
+        void (*convert)(const std::byte*, std::byte*) noexcept = nullptr;
+    };
+
+    // converts the binary records of a stored schema to T, matching the fields by name
+    template <field_namable T>
+    requires field_layoutable<T> && std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+    class record_converter
+    {
+        std::size_t source_size_ = 0;
+        bool has_default_ = false;
+        std::vector<conversion_step> plan_;
+
+        static void add_copy(std::vector<conversion_step>& plan, std::size_t source, std::size_t target,
+                             std::size_t size)
+        {
+            // extend the previous copy over the bytes in between if the fields are equally apart in both layouts
+            if (!plan.empty() && plan.back().kind == conversion_kind::copy &&
+                plan.back().source_offset + plan.back().size <= source &&
+                plan.back().target_offset + plan.back().size <= target &&
+                source - plan.back().source_offset == target - plan.back().target_offset)
+            {
+                plan.back().size = target + size - plan.back().target_offset;
+                return;
+            }
+            plan.push_back(conversion_step{conversion_kind::copy, source, target, size});
+        }
+
+    public:
+        explicit record_converter(const record_schema& stored) : source_size_(static_cast<std::size_t>(stored.size))
+        {
+            if (!layout_verified<T>()) throw std::runtime_error("record_converter: layout of the type is not verified");
+            if (source_size_ == 0) throw std::runtime_error("record_converter: record size is zero");
+            for (const auto& field : stored.fields)
+            {
+                if (field.offset > stored.size || field.size > stored.size - field.offset)
+                {
+                    throw std::runtime_error("record_converter: field " + field.name + " is out of the record");
+                }
+            }
+
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (..., [&]() {
+                    using field = std::remove_cvref_t<field_type<T, Is>>;
+                    constexpr auto name = field_name<T, Is>;
+                    constexpr auto offset = field_offset<T, Is>;
+                    constexpr auto size = field_size<T, Is>;
+
+                    const auto it = std::ranges::find(stored.fields, name, &field_schema::name);
+                    if (it == stored.fields.end())
+                    {
+                        plan_.push_back(conversion_step{conversion_kind::default_value, 0, offset, size});
+                        has_default_ = true;
+                    }
+                    else if (it->type_name == type_name<field> && it->size == size && it->hash == schema_hash<field>)
+                    {
+                        add_copy(plan_, static_cast<std::size_t>(it->offset), offset, size);
+                    }
+                    else if (const auto convert = detail::find_field_converter<field>(*it); convert != nullptr)
+                    {
+                        plan_.push_back(conversion_step{conversion_kind::convert,
+                                                        static_cast<std::size_t>(it->offset), offset, size, convert});
+                    }
+                    else
+                    {
+                        throw std::runtime_error("record_converter: cannot convert field " + it->name + " from " +
+                                                 it->type_name + " to " + std::string(type_name<field>));
+                    }
+                }());
+            }(std::make_index_sequence<field_count<T>>());
+        }
+
+        [[nodiscard]] const std::vector<conversion_step>& plan() const noexcept { return plan_; }
+        [[nodiscard]] std::size_t source_size() const noexcept { return source_size_; }
+
+        // whether the stored records have the layout of T and can be copied as a whole
+        [[nodiscard]] bool is_identity() const noexcept
+        {
+            return source_size_ == sizeof(T) && plan_.size() == 1 && plan_[0].kind == conversion_kind::copy &&
+                   plan_[0].source_offset == 0 && plan_[0].target_offset == 0;
+        }
+
+        // converts a record of source_size() bytes
+        void convert(const std::byte* source, T& out) const noexcept
+        {
+            if (has_default_) out = T{};
+            auto* target = reinterpret_cast<std::byte*>(&out);  // NOLINT
+            for (const auto& step : plan_)
+            {
+                switch (step.kind)
+                {
+                    case conversion_kind::copy:
+                        std::memcpy(target + step.target_offset, source + step.source_offset, step.size);
+                        break;
+                    case conversion_kind::convert:
+                        step.convert(source + step.source_offset, target + step.target_offset);
+                        break;
+                    case conversion_kind::default_value:
+                    default:
+                        break;
+                }
+            }
+        }
+
+        [[nodiscard]] T convert(std::span<const std::byte> record) const
+        {
+            if (record.size() < source_size_) throw std::out_of_range("record_converter: record is too short");
+            auto result = T{};
+            convert(record.data(), result);
+            return result;
+        }
+
+        // converts consecutive records of source_size() bytes each
+        void convert(std::span<const std::byte> records, std::span<T> out) const
+        {
+            if (records.size() != out.size() * source_size_)
+            {
+                throw std::length_error("record_converter: number of records differs");
+            }
+            if (is_identity())
+            {
+                if (!out.empty()) std::memcpy(out.data(), records.data(), records.size());
+                return;
+            }
+            for (std::size_t i = 0; i < out.size(); ++i) convert(records.data() + i * source_size_, out[i]);
+        }
+
+        [[nodiscard]] std::vector<T> convert_all(std::span<const std::byte> records) const
+        {
+            auto result = std::vector<T>(records.size() / source_size_);
+            convert(records.first(result.size() * source_size_), std::span(result));
+            return result;
+        }
+    };
+}  // namespace field_reflection
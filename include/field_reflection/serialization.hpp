@@ -0,0 +1,469 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <array>
+#include <climits>  // CHAR_BIT
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>  // std::reference_wrapper
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../field_reflection.hpp"
+
+namespace field_reflection
+{
+    namespace detail
+    {
+        template <typename T>
+        concept byte_buffer = std::ranges::contiguous_range<T> && std::ranges::sized_range<T> &&
+                              sizeof(std::ranges::range_value_t<T>) == 1 &&
+                              std::is_trivially_copyable_v<std::ranges::range_value_t<T>> &&
+                              requires(T& buffer, std::size_t n) { buffer.resize(n); };
+
+        template <typename T>
+        struct is_reference_wrapper : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type
+        {
+        };
+
+        // values written as their bytes; pointers, pointer-like wrappers and views are excluded as their bytes refer
+        // to other memory, and optional and tuple-like types are written by their elements so that those are checked
+        template <typename T>
+        constexpr bool bitwise_serializable = []() {
+            if constexpr (is_std_array<T>::value)
+            {
+                return bitwise_serializable<typename T::value_type>;
+            }
+            else if constexpr (std::is_pointer_v<T> || std::is_member_pointer_v<T> || std::ranges::range<T> ||
+                               is_reference_wrapper<T>::value || is_optional<T>::value || tuple_like<T>)
+            {
+                return false;
+            }
+            else if constexpr (field_referenceable<T>)
+            {
+                if constexpr (field_layout_proven<T>)
+                {
+                    return std::is_trivially_copyable_v<T> && !has_padding<T> &&
+                           []<std::size_t... Is>(std::index_sequence<Is...>) {
+                               return (bitwise_serializable<field_type<T, Is>> && ...);
+                           }(std::make_index_sequence<field_count<T>>());
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return std::is_trivially_copyable_v<T>;
+            }
+        }();
+
+        template <typename T>
+        struct bitwise_serializable_trait : std::bool_constant<bitwise_serializable<T>>
+        {
+        };
+
+        template <field_referenceable T>
+        constexpr auto serialization_segments = make_field_segments<T, bitwise_serializable_trait>();
+
+        template <typename T>
+        std::size_t serialized_size_of(const T& value);
+
+        template <typename T>
+        std::byte* serialize_to(const T& value, std::byte* out);
+
+        template <typename T>
+        std::size_t serialized_size_of(const T& value)
+        {
+            if constexpr (bitwise_serializable<T>)
+            {
+                return sizeof(T);
+            }
+            else if constexpr (tuple_like<T>)
+            {
+                return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return (std::size_t{0} + ... + serialized_size_of(std::get<Is>(value)));
+                }(std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (is_optional<T>::value)
+            {
+                return 1 + (value.has_value() ? serialized_size_of(*value) : 0);
+            }
+            else if constexpr (std::ranges::range<T>)
+            {
+                using element = std::ranges::range_value_t<T>;
+                if constexpr (std::ranges::sized_range<T> && bitwise_serializable<element>)
+                {
+                    return sizeof(std::uint64_t) + std::ranges::size(value) * sizeof(element);
+                }
+                else
+                {
+                    auto size = sizeof(std::uint64_t);
+                    for (const element& e : value) size += serialized_size_of(e);
+                    return size;
+                }
+            }
+            else if constexpr (field_referenceable<T>)
+            {
+                return [&]<std::size_t... Ss>(std::index_sequence<Ss...>) {
+                    constexpr auto& segments = serialization_segments<T>.first;
+                    return (std::size_t{0} + ... +
+                            (segments[Ss].bitwise ? segments[Ss].size
+                                                  : serialized_size_of(get_field<segments[Ss].first>(value))));
+                }(std::make_index_sequence<serialization_segments<T>.second>());
+            }
+            else
+            {
+                static_assert(always_false<T>, "field type is not serializable");
+            }
+        }
+
+        // a merged run of bitwise fields is copied at once if the layout of T is verified, otherwise field by field
+        template <std::size_t S, typename T>
+        std::byte* serialize_segment(const T& value, std::byte* out)
+        {
+            constexpr auto segment = serialization_segments<T>.first[S];
+            if constexpr (segment.bitwise)
+            {
+                if (segment.last - segment.first == 1 || layout_verified<T>())
+                {
+                    std::memcpy(out, std::addressof(get_field<segment.first>(value)), segment.size);
+                    return out + segment.size;
+                }
+            }
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (..., (out = serialize_to(get_field<segment.first + Is>(value), out)));
+                return out;
+            }(std::make_index_sequence<segment.last - segment.first>());
+        }
+
+        template <typename T>
+        std::byte* serialize_to(const T& value, std::byte* out)
+        {
+            if constexpr (bitwise_serializable<T>)
+            {
+                std::memcpy(out, std::addressof(value), sizeof(T));
+                return out + sizeof(T);
+            }
+            else if constexpr (tuple_like<T>)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ((out = serialize_to(std::get<Is>(value), out)), ...);
+                }(std::make_index_sequence<std::tuple_size_v<T>>());
+                return out;
+            }
+            else if constexpr (is_optional<T>::value)
+            {
+                *out++ = std::byte{value.has_value()};
+                return value.has_value() ? serialize_to(*value, out) : out;
+            }
+            else if constexpr (std::ranges::range<T>)
+            {
+                using element = std::ranges::range_value_t<T>;
+                const auto count = static_cast<std::uint64_t>(std::ranges::distance(value));
+                std::memcpy(out, &count, sizeof(count));
+                out += sizeof(count);
+                if constexpr (std::ranges::contiguous_range<T> && bitwise_serializable<element>)
+                {
+                    if (count > 0) std::memcpy(out, std::ranges::data(value), count * sizeof(element));
+                    return out + count * sizeof(element);
+                }
+                else
+                {
+                    for (const element& e : value) out = serialize_to(e, out);
+                    return out;
+                }
+            }
+            else
+            {
+                [&]<std::size_t... Ss>(std::index_sequence<Ss...>) {
+                    (..., (out = serialize_segment<Ss>(value, out)));
+                }(std::make_index_sequence<serialization_segments<T>.second>());
+                return out;
+            }
+        }
+
+        class deserializer
+        {
+            const std::byte* first_;
+            const std::byte* last_;
+
+        public:
+            explicit deserializer(std::span<const std::byte> bytes) noexcept
+                : first_(bytes.data()), last_(bytes.data() + bytes.size())
+            {
+            }
+
+            [[nodiscard]] const std::byte* position() const noexcept { return first_; }
+
+            [[nodiscard]] std::size_t remaining() const noexcept { return static_cast<std::size_t>(last_ - first_); }
+
+            void read(void* dest, std::size_t size)
+            {
+                if (size > remaining()) throw std::out_of_range("deserialize: unexpected end of input");
+                if (size > 0) std::memcpy(dest, first_, size);
+                first_ += size;
+            }
+
+            template <typename T>
+            T read_value()
+            {
+                if constexpr (tuple_like<T> && !bitwise_serializable<T>)
+                {
+                    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                        return T{read_value<std::remove_const_t<std::tuple_element_t<Is, T>>>()...};
+                    }(std::make_index_sequence<std::tuple_size_v<T>>());
+                }
+                else
+                {
+                    auto value = T{};
+                    read_into(value);
+                    return value;
+                }
+            }
+
+            template <std::size_t S, typename T>
+            void read_segment(T& value)
+            {
+                constexpr auto segment = serialization_segments<T>.first[S];
+                if constexpr (segment.bitwise)
+                {
+                    if (segment.last - segment.first == 1 || layout_verified<T>())
+                    {
+                        return read(std::addressof(get_field<segment.first>(value)), segment.size);
+                    }
+                }
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (..., read_into(get_field<segment.first + Is>(value)));
+                }(std::make_index_sequence<segment.last - segment.first>());
+            }
+
+            template <typename T>
+            void read_into(T& value)
+            {
+                static_assert(!std::is_const_v<T>, "const field is not deserializable");
+                if constexpr (bitwise_serializable<T>)
+                {
+                    read(std::addressof(value), sizeof(T));
+                }
+                else if constexpr (tuple_like<T>)
+                {
+                    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                        (read_into(std::get<Is>(value)), ...);
+                    }(std::make_index_sequence<std::tuple_size_v<T>>());
+                }
+                else if constexpr (is_optional<T>::value)
+                {
+                    auto has_value = std::byte{};
+                    read(&has_value, 1);
+                    if (has_value != std::byte{0})
+                    {
+                        value.emplace(read_value<typename T::value_type>());
+                    }
+                    else
+                    {
+                        value.reset();
+                    }
+                }
+                else if constexpr (std::ranges::range<T>)
+                {
+                    using element = typename T::value_type;
+                    auto count = std::uint64_t{};
+                    read(&count, sizeof(count));
+                    if constexpr (std::ranges::contiguous_range<T> && bitwise_serializable<element> &&
+                                  requires { value.resize(std::size_t{}); })
+                    {
+                        if (count > remaining() / sizeof(element))
+                        {
+                            throw std::out_of_range("deserialize: unexpected end of input");
+                        }
+                        value.resize(static_cast<std::size_t>(count));
+                        read(std::ranges::data(value), static_cast<std::size_t>(count) * sizeof(element));
+                    }
+                    else
+                    {
+                        value.clear();
+                        if constexpr (requires { value.reserve(std::size_t{}); })
+                        {
+                            value.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(count, remaining())));
+                        }
+                        for (std::uint64_t i = 0; i < count; ++i) value.insert(value.end(), read_value<element>());
+                    }
+                }
+                else if constexpr (field_referenceable<T>)
+                {
+                    [&]<std::size_t... Ss>(std::index_sequence<Ss...>) {
+                        (..., read_segment<Ss>(value));
+                    }(std::make_index_sequence<serialization_segments<T>.second>());
+                }
+                else
+                {
+                    static_assert(always_false<T>, "field type is not deserializable");
+                }
+            }
+        };
+
+        // nested structs are encoded as deltas themselves instead of whole values
+        template <typename T>
+        concept delta_nestable = field_referenceable<T> && !tuple_like<T> && !std::ranges::range<T>;
+
+        template <field_referenceable T>
+        constexpr auto delta_mask_size = (field_count<T> + CHAR_BIT - 1) / CHAR_BIT;
+
+        // appends the mask of changed fields and their new values, and returns whether any field changed
+        template <field_referenceable T, byte_buffer Buffer>
+        bool write_delta(const T& old_value, const T& new_value, Buffer& out)
+        {
+            const auto mask = std::ranges::size(out);
+            out.resize(mask + delta_mask_size<T>);
+            std::memset(std::ranges::data(out) + mask, 0, delta_mask_size<T>);
+
+            const auto mark = [&](std::size_t index) {
+                auto* bytes = reinterpret_cast<std::byte*>(std::ranges::data(out)) + mask;  // NOLINT
+                bytes[index / CHAR_BIT] |= std::byte{1} << (index % CHAR_BIT);
+            };
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return (... | [&]() {
+                    const auto& a = get_field<Is>(old_value);
+                    const auto& b = get_field<Is>(new_value);
+                    using field = std::remove_cvref_t<decltype(b)>;
+                    if constexpr (delta_nestable<field>)
+                    {
+                        const auto size = std::ranges::size(out);
+                        if (!write_delta(a, b, out))
+                        {
+                            out.resize(size);
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        if (field_equal(a, b)) return false;
+                        const auto size = std::ranges::size(out);
+                        out.resize(size + serialized_size_of(b));
+                        serialize_to(b, reinterpret_cast<std::byte*>(std::ranges::data(out)) + size);  // NOLINT
+                    }
+                    mark(Is);
+                    return true;
+                }());
+            }(std::make_index_sequence<field_count<T>>());
+        }
+
+        template <field_referenceable T>
+        void read_delta(deserializer& reader, T& value)
+        {
+            auto mask = std::array<std::byte, delta_mask_size<T>>{};
+            reader.read(mask.data(), mask.size());
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (..., [&]() {
+                    if ((mask[Is / CHAR_BIT] & (std::byte{1} << (Is % CHAR_BIT))) == std::byte{0}) return;
+                    auto& field = get_field<Is>(value);
+                    if constexpr (delta_nestable<std::remove_cvref_t<decltype(field)>>)
+                    {
+                        read_delta(reader, field);
+                    }
+                    else
+                    {
+                        reader.read_into(field);
+                    }
+                }());
+            }(std::make_index_sequence<field_count<T>>());
+        }
+    }  // namespace detail
+
+    template <field_referenceable T>
+    std::size_t serialized_size(const T& value)
+    {
+        return detail::serialized_size_of(value);
+    }
+
+    // appends to the buffer and returns the number of bytes written
+    template <field_referenceable T, detail::byte_buffer Buffer>
+    std::size_t serialize(const T& value, Buffer& out)
+    {
+        const auto offset = std::ranges::size(out);
+        const auto size = detail::serialized_size_of(value);
+        out.resize(offset + size);
+        detail::serialize_to(value, reinterpret_cast<std::byte*>(std::ranges::data(out)) + offset);  // NOLINT
+        return size;
+    }
+
+    template <field_referenceable T>
+    std::size_t serialize(const T& value, std::span<std::byte> out)
+    {
+        const auto size = detail::serialized_size_of(value);
+        if (size > out.size()) throw std::length_error("serialize: output buffer is too small");
+        detail::serialize_to(value, out.data());
+        return size;
+    }
+
+    template <field_referenceable T>
+    std::vector<std::byte> serialize(const T& value)
+    {
+        auto out = std::vector<std::byte>{};
+        serialize(value, out);
+        return out;
+    }
+
+    // returns the number of bytes read
+    template <field_referenceable T>
+    std::size_t deserialize(std::span<const std::byte> bytes, T& value)
+    {
+        auto reader = detail::deserializer(bytes);
+        reader.read_into(value);
+        return static_cast<std::size_t>(reader.position() - bytes.data());
+    }
+
+    template <field_referenceable T>
+    T deserialize(std::span<const std::byte> bytes)
+    {
+        return detail::deserializer(bytes).read_value<T>();
+    }
+
+    // appends the delta from old_value to new_value and returns whether any field changed
+    template <field_referenceable T, detail::byte_buffer Buffer>
+    bool make_delta(const T& old_value, const T& new_value, Buffer& out)
+    {
+        return detail::write_delta(old_value, new_value, out);
+    }
+
+    template <field_referenceable T>
+    std::vector<std::byte> make_delta(const T& old_value, const T& new_value)
+    {
+        auto out = std::vector<std::byte>{};
+        detail::write_delta(old_value, new_value, out);
+        return out;
+    }
+
+    // returns the number of bytes read
+    template <field_referenceable T>
+    std::size_t apply_delta(T& value, std::span<const std::byte> delta)
+    {
+        auto reader = detail::deserializer(delta);
+        detail::read_delta(reader, value);
+        return static_cast<std::size_t>(reader.position() - delta.data());
+    }
+}  // namespace field_reflection
@@ -0,0 +1,538 @@
+/*===================================================*
+|  field-reflection version v0.3.2                   |
+|  https://github.com/yosh-matsuda/field-reflection  |
+|                                                    |
+|  Copyright (c) 2026 Yoshiki Matsuda @yosh-matsuda  |
+|                                                    |
+|  This software is released under the MIT License.  |
+|  https://opensource.org/license/mit/               |
+====================================================*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../field_reflection.hpp"
+
+namespace field_reflection
+{
+    template <typename T>
+    class soa_vector;
+
+    namespace detail
+    {
+        template <typename T>
+        concept soa_storable =
+            field_referenceable<T> && []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return ((std::is_object_v<field_type<T, Is>> && !std::is_const_v<field_type<T, Is>> &&
+                         !std::is_array_v<field_type<T, Is>> && std::is_destructible_v<field_type<T, Is>>) &&
+                        ...);
+            }(std::make_index_sequence<field_count<T>>());
+
+        template <typename T, typename = std::make_index_sequence<field_count<T>>>
+        struct soa_columns;
+
+        template <typename T, std::size_t... Is>
+        struct soa_columns<T, std::index_sequence<Is...>>
+        {
+            using type = std::tuple<field_type<T, Is>*...>;
+        };
+
+        template <typename T>
+        using soa_columns_t = typename soa_columns<T>::type;
+    }  // namespace detail
+
+    // proxy to the row of a soa_vector, Vector is soa_vector<T> or const soa_vector<T>
+    template <typename Vector>
+    class soa_reference
+    {
+        using vector_type = std::remove_const_t<Vector>;
+        friend vector_type;
+        template <typename>
+        friend class soa_iterator;
+
+        Vector* vector_;
+        std::size_t index_;
+
+        constexpr soa_reference(Vector* vector, std::size_t index) noexcept : vector_(vector), index_(index) {}
+
+        template <typename V, std::size_t... Is>
+        constexpr void assign(V&& value, std::index_sequence<Is...>) const
+        {
+            if constexpr (std::is_rvalue_reference_v<V&&>)
+            {
+                ((get<Is>() = std::move(get_field<Is>(value))), ...);
+            }
+            else
+            {
+                ((get<Is>() = get_field<Is>(value)), ...);
+            }
+        }
+
+        // constructs the value by moving each field out of the row, or by copying them from a const vector
+        constexpr auto take() const
+        {
+            return [this]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return value_type{std::move(get<Is>())...};
+            }(std::make_index_sequence<field_count<value_type>>());
+        }
+
+    public:
+        using value_type = typename vector_type::value_type;
+
+        soa_reference(const soa_reference&) noexcept = default;
+        ~soa_reference() = default;
+
+        template <std::size_t N>
+        constexpr auto& get() const noexcept
+        {
+            auto& field = std::get<N>(vector_->columns_)[index_];
+            if constexpr (std::is_const_v<Vector>)
+            {
+                return std::as_const(field);
+            }
+            else
+            {
+                return field;
+            }
+        }
+
+        constexpr operator value_type() const
+        {
+            return [this]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return value_type{get<Is>()...};
+            }(std::make_index_sequence<field_count<value_type>>());
+        }
+
+        // assignments write through to the row, as for the element of other containers
+        constexpr const soa_reference& operator=(const soa_reference& other) const
+        requires (!std::is_const_v<Vector>)
+        {
+            if (this != &other) *this = static_cast<value_type>(other);
+            return *this;
+        }
+
+        constexpr const soa_reference& operator=(const value_type& value) const
+        requires (!std::is_const_v<Vector>)
+        {
+            assign(value, std::make_index_sequence<field_count<value_type>>());
+            return *this;
+        }
+
+        constexpr const soa_reference& operator=(value_type&& value) const
+        requires (!std::is_const_v<Vector>)
+        {
+            assign(std::move(value), std::make_index_sequence<field_count<value_type>>());
+            return *this;
+        }
+
+        constexpr operator soa_reference<const vector_type>() const noexcept
+        requires (!std::is_const_v<Vector>)
+        {
+            return {vector_, index_};
+        }
+
+        friend constexpr void swap(const soa_reference& a, const soa_reference& b)
+        requires (!std::is_const_v<Vector>)
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                using std::swap;
+                (swap(a.template get<Is>(), b.template get<Is>()), ...);
+            }(std::make_index_sequence<field_count<value_type>>());
+        }
+    };
+
+    template <typename Vector>
+    class soa_iterator
+    {
+        using vector_type = std::remove_const_t<Vector>;
+        friend vector_type;
+        friend class soa_iterator<const vector_type>;
+
+        Vector* vector_ = nullptr;
+        std::ptrdiff_t index_ = 0;
+
+        constexpr soa_iterator(Vector* vector, std::ptrdiff_t index) noexcept : vector_(vector), index_(index) {}
+
+        constexpr auto take() const { return soa_reference<Vector>(vector_, static_cast<std::size_t>(index_)).take(); }
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename vector_type::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = soa_reference<Vector>;
+
+        soa_iterator() noexcept = default;
+
+        template <typename V>
+        requires (std::is_const_v<Vector> && std::is_same_v<V, vector_type>)
+        constexpr soa_iterator(const soa_iterator<V>& other) noexcept : vector_(other.vector_), index_(other.index_)
+        {
+        }
+
+        constexpr reference operator*() const noexcept { return {vector_, static_cast<std::size_t>(index_)}; }
+        constexpr reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        constexpr soa_iterator& operator++() noexcept { return ++index_, *this; }
+        constexpr soa_iterator operator++(int) noexcept { return {vector_, index_++}; }
+        constexpr soa_iterator& operator--() noexcept { return --index_, *this; }
+        constexpr soa_iterator operator--(int) noexcept { return {vector_, index_--}; }
+        constexpr soa_iterator& operator+=(difference_type n) noexcept { return index_ += n, *this; }
+        constexpr soa_iterator& operator-=(difference_type n) noexcept { return index_ -= n, *this; }
+
+        friend constexpr soa_iterator operator+(soa_iterator it, difference_type n) noexcept { return it += n; }
+        friend constexpr soa_iterator operator+(difference_type n, soa_iterator it) noexcept { return it += n; }
+        friend constexpr soa_iterator operator-(soa_iterator it, difference_type n) noexcept { return it -= n; }
+        friend constexpr difference_type operator-(const soa_iterator& a, const soa_iterator& b) noexcept
+        {
+            return a.index_ - b.index_;
+        }
+        friend constexpr bool operator==(const soa_iterator& a, const soa_iterator& b) noexcept
+        {
+            return a.index_ == b.index_;
+        }
+        friend constexpr auto operator<=>(const soa_iterator& a, const soa_iterator& b) noexcept
+        {
+            return a.index_ <=> b.index_;
+        }
+
+        // returns the value rather than the proxy, so that the algorithms move the fields
+        friend constexpr value_type iter_move(const soa_iterator& it) noexcept(
+            std::is_const_v<Vector> ? std::is_nothrow_copy_constructible_v<value_type>
+                                    : std::is_nothrow_move_constructible_v<value_type>)
+        {
+            return it.take();
+        }
+    };
+
+    // sequence container of T that stores each field in its own contiguous column
+    template <typename T>
+    class soa_vector
+    {
+        static_assert(detail::soa_storable<T>,
+                      "soa_vector requires a field_referenceable type without reference, const or array fields");
+
+        friend class soa_reference<soa_vector>;
+        friend class soa_reference<const soa_vector>;
+
+        static constexpr auto indices = std::make_index_sequence<field_count<T>>();
+
+        detail::soa_columns_t<T> columns_{};
+        std::size_t size_ = 0;
+        std::size_t capacity_ = 0;
+
+        template <std::size_t... Is>
+        static void deallocate(detail::soa_columns_t<T>& columns, std::size_t capacity,
+                               std::index_sequence<Is...>) noexcept
+        {
+            (..., (std::get<Is>(columns) != nullptr
+                       ? std::allocator<field_type<T, Is>>().deallocate(std::get<Is>(columns), capacity)
+                       : void()));
+        }
+
+        // moves unless the move may throw and a copy is possible, as std::move_if_noexcept
+        template <typename F>
+        static constexpr bool relocate_by_copy =
+            !std::is_nothrow_move_constructible_v<F> && std::is_copy_constructible_v<F>;
+
+        // the copied columns are relocated first, whose sources stay intact if a later column throws, and the columns
+        // moved without throwing last, which cannot fail after another column has been moved
+        template <typename F>
+        static constexpr int relocation_pass =
+            relocate_by_copy<F> ? 0 : (std::is_nothrow_move_constructible_v<F> ? 2 : 1);
+
+        template <typename F>
+        static void relocate(F* first, F* last, F* dest)
+        {
+            if constexpr (relocate_by_copy<F>)
+            {
+                std::uninitialized_copy(first, last, dest);
+            }
+            else
+            {
+                std::uninitialized_move(first, last, dest);
+            }
+        }
+
+        // destroys the first `count` fields of the row at `index`
+        template <std::size_t... Is>
+        void destroy_row(std::size_t index, std::size_t count, std::index_sequence<Is...>) noexcept
+        {
+            (..., (Is < count ? std::destroy_at(std::get<Is>(columns_) + index) : void()));
+        }
+
+        template <std::size_t... Is>
+        void destroy_rows(std::size_t first, std::size_t last, std::index_sequence<Is...>) noexcept
+        {
+            (std::destroy(std::get<Is>(columns_) + first, std::get<Is>(columns_) + last), ...);
+        }
+
+        // constructs a new row at the end from one argument per field, or value-initializes it without arguments
+        template <typename... Args>
+        void construct_back(Args&&... args)
+        {
+            if (size_ == capacity_) reserve(std::max(capacity_ * 2, std::size_t{8}));
+            auto constructed = std::size_t{0};
+            try
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    if constexpr (sizeof...(Args) == 0)
+                    {
+                        ((std::construct_at(std::get<Is>(columns_) + size_), ++constructed), ...);
+                    }
+                    else
+                    {
+                        auto refs = std::forward_as_tuple(std::forward<Args>(args)...);
+                        ((std::construct_at(std::get<Is>(columns_) + size_, std::get<Is>(std::move(refs))),
+                          ++constructed),
+                         ...);
+                    }
+                }(indices);
+            }
+            catch (...)
+            {
+                destroy_row(size_, constructed, indices);
+                throw;
+            }
+            ++size_;
+        }
+
+        template <typename V, std::size_t... Is>
+        void push_back_impl(V&& value, std::index_sequence<Is...>)
+        {
+            if constexpr (std::is_rvalue_reference_v<V&&>)
+            {
+                construct_back(std::move(get_field<Is>(value))...);
+            }
+            else
+            {
+                construct_back(get_field<Is>(value)...);
+            }
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = soa_reference<soa_vector>;
+        using const_reference = soa_reference<const soa_vector>;
+        using iterator = soa_iterator<soa_vector>;
+        using const_iterator = soa_iterator<const soa_vector>;
+
+        soa_vector() noexcept = default;
+
+        // the constructors delegate to the default one, so that the destructor releases the rows and columns when
+        // the construction of an element throws
+        explicit soa_vector(size_type count) : soa_vector() { resize(count); }
+
+        soa_vector(size_type count, const T& value) : soa_vector() { resize(count, value); }
+
+        soa_vector(std::initializer_list<T> init) : soa_vector()
+        {
+            reserve(init.size());
+            for (const auto& value : init) push_back(value);
+        }
+
+        soa_vector(const soa_vector& other) : soa_vector()
+        {
+            reserve(other.size_);
+            for (size_type i = 0; i < other.size_; ++i)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    construct_back(std::get<Is>(other.columns_)[i]...);
+                }(indices);
+            }
+        }
+
+        soa_vector(soa_vector&& other) noexcept
+            : columns_(std::exchange(other.columns_, {})),
+              size_(std::exchange(other.size_, 0)),
+              capacity_(std::exchange(other.capacity_, 0))
+        {
+        }
+
+        soa_vector& operator=(const soa_vector& other)
+        {
+            if (this != &other) soa_vector(other).swap(*this);
+            return *this;
+        }
+
+        soa_vector& operator=(soa_vector&& other) noexcept
+        {
+            soa_vector(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        ~soa_vector()
+        {
+            clear();
+            deallocate(columns_, capacity_, indices);
+        }
+
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+        [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        // reallocates all columns at once; the strong exception guarantee holds unless a field is move-only with a
+        // throwing move constructor, as for std::vector
+        void reserve(size_type new_capacity)
+        {
+            if (new_capacity <= capacity_) return;
+
+            auto columns = detail::soa_columns_t<T>{};
+            auto relocated = std::array<bool, field_count<T>>{};
+            try
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ((std::get<Is>(columns) = std::allocator<field_type<T, Is>>().allocate(new_capacity)), ...);
+                    for (const auto pass : {0, 1, 2})
+                    {
+                        (..., (relocation_pass<field_type<T, Is>> == pass
+                                   ? (relocate(std::get<Is>(columns_), std::get<Is>(columns_) + size_,
+                                               std::get<Is>(columns)),
+                                      void(relocated[Is] = true))
+                                   : void()));
+                    }
+                }(indices);
+            }
+            catch (...)
+            {
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (..., (relocated[Is] ? std::destroy(std::get<Is>(columns), std::get<Is>(columns) + size_)
+                                         : void()));
+                }(indices);
+                deallocate(columns, new_capacity, indices);
+                throw;
+            }
+
+            destroy_rows(0, size_, indices);
+            deallocate(columns_, capacity_, indices);
+            columns_ = columns;
+            capacity_ = new_capacity;
+        }
+
+        void resize(size_type count)
+        {
+            if (count < size_) return erase_back(count);
+            reserve(count);
+            while (size_ < count) construct_back();
+        }
+
+        void resize(size_type count, const T& value)
+        {
+            if (count < size_) return erase_back(count);
+            reserve(count);
+            while (size_ < count) push_back(value);
+        }
+
+        void clear() noexcept { erase_back(0); }
+
+        void push_back(const T& value) { push_back_impl(value, indices); }
+
+        void push_back(T&& value) { push_back_impl(std::move(value), indices); }
+
+        // constructs a row in place from one argument per field
+        template <typename... Args>
+        requires (sizeof...(Args) == field_count<T>)
+        reference emplace_back(Args&&... args)
+        {
+            construct_back(std::forward<Args>(args)...);
+            return back();
+        }
+
+        void pop_back() noexcept { erase_back(size_ - 1); }
+
+        reference operator[](size_type index) noexcept { return {this, index}; }
+        const_reference operator[](size_type index) const noexcept { return {this, index}; }
+
+        reference at(size_type index)
+        {
+            if (index >= size_) throw std::out_of_range("soa_vector::at");
+            return {this, index};
+        }
+
+        const_reference at(size_type index) const
+        {
+            if (index >= size_) throw std::out_of_range("soa_vector::at");
+            return {this, index};
+        }
+
+        reference front() noexcept { return {this, 0}; }
+        const_reference front() const noexcept { return {this, 0}; }
+        reference back() noexcept { return {this, size_ - 1}; }
+        const_reference back() const noexcept { return {this, size_ - 1}; }
+
+        iterator begin() noexcept { return {this, 0}; }
+        iterator end() noexcept { return {this, static_cast<difference_type>(size_)}; }
+        const_iterator begin() const noexcept { return {this, 0}; }
+        const_iterator end() const noexcept { return {this, static_cast<difference_type>(size_)}; }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        template <std::size_t N>
+        std::span<field_type<T, N>> column() noexcept
+        {
+            return {std::get<N>(columns_), size_};
+        }
+
+        template <std::size_t N>
+        std::span<const field_type<T, N>> column() const noexcept
+        {
+            return {std::get<N>(columns_), size_};
+        }
+
+        void swap(soa_vector& other) noexcept
+        {
+            std::swap(columns_, other.columns_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+        }
+
+        friend void swap(soa_vector& a, soa_vector& b) noexcept { a.swap(b); }
+
+    private:
+        void erase_back(size_type count) noexcept
+        {
+            destroy_rows(count, size_, indices);
+            size_ = count;
+        }
+    };
+
+    template <std::size_t N, typename Vector>
+    constexpr auto& get_field(const soa_reference<Vector>& ref) noexcept
+    {
+        return ref.template get<N>();
+    }
+
+    template <typename Vector, typename Func>
+    void for_each_field(const soa_reference<Vector>& ref, Func&& func)
+    {
+        using U = typename soa_reference<Vector>::value_type;
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            if constexpr (requires { (func(ref.template get<Is>()), ...); })
+            {
+                (func(ref.template get<Is>()), ...);
+            }
+            else if constexpr (requires { (func(field_name<U, Is>, ref.template get<Is>()), ...); })
+            {
+                (func(field_name<U, Is>, ref.template get<Is>()), ...);
+            }
+            else
+            {
+                static_assert(detail::always_false<std::remove_cvref_t<Func>>,
+                              "invalid function object for call to for_each_field");
+            }
+        }(std::make_index_sequence<field_count<U>>());
+    }
+}  // namespace field_reflection
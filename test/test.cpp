@@ -1,13 +1,20 @@
 #include <gtest/gtest.h>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <variant>
+#include <vector>
 #include "field_reflection.hpp"
 
+#if defined(FIELD_RFL_FIELDS_1) || defined(FIELD_RFL_FIELDS_16) || defined(FIELD_RFL_FIELDS_17)
+#error "the field list macros are not undefined"
+#endif
+
 // NOLINTBEGIN
 using namespace field_reflection;
 
@@ -133,6 +140,81 @@ struct my_struct15
 {
 };
 
+// struct with a reference member after a defaulted member
+struct my_struct16
+{
+    int i = 0;
+    double d = 0.0;
+    const int& r;
+};
+
+// struct with bit-fields
+struct my_struct17
+{
+    uint8_t b0 : 1;
+    uint8_t b1 : 1;
+    uint8_t b2 : 1;
+    uint8_t b3 : 1;
+    uint8_t b4 : 1;
+    uint8_t b5 : 1;
+    uint8_t b6 : 1;
+    uint8_t b7 : 1;
+};
+
+// struct with the maximum number of fields
+struct my_struct18
+{
+    int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22,
+        f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+        f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63, f64,
+        f65, f66, f67, f68, f69, f70, f71, f72, f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85,
+        f86, f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98, f99;
+};
+
+// struct with padding
+struct my_struct19
+{
+    char c;
+    int i;
+    char c2;
+};
+
+// struct with an over-aligned member
+struct my_struct20
+{
+    int i;
+    alignas(16) int j;
+};
+
+// struct with an over-aligned member that does not change its size
+struct over_aligned_gap
+{
+    char a;
+    alignas(2) char b;
+    char c;
+    int x;
+    bool operator==(const over_aligned_gap&) const = default;
+};
+
+// the same with a non-trivially copyable member, whose layout is not refuted at compile time
+struct over_aligned_string
+{
+    char a;
+    alignas(2) char b;
+    char c;
+    int x;
+    std::string s;
+};
+
+// trivially copyable struct with padding and nested aggregates
+struct trivial_layout
+{
+    int i;
+    double d;
+    std::array<uint64_t, 3> arr;
+    my_struct19 nested;
+};
+
 #if defined(__GNUC__) || defined(__clang__)
 struct packed_other_elements
 {
@@ -236,6 +318,9 @@ TEST(field_reflection, field_count)
     static_assert(field_count<my_struct14> == 1);
     static_assert(field_count<my_struct15> == 0);
     static_assert(field_count<std::monostate> == 0);
+    static_assert(field_count<my_struct16> == 3);
+    static_assert(field_count<my_struct17> == 8);
+    static_assert(field_count<my_struct18> == 100);
 #if defined(__GNUC__) || defined(__clang__)
     static_assert(field_count<packed_element_size> == 3);
     static_assert(field_count<packed_const_element> == 1);
@@ -302,6 +387,8 @@ TEST(field_reflection, field_name)
     static_assert(field_name<my_struct12, 0> == "value");
     static_assert(field_name<my_struct13, 0> == "value");
     static_assert(field_name<my_struct14, 0> == "value");
+    static_assert(field_name<my_struct18, 0> == "f0");
+    static_assert(field_name<my_struct18, 99> == "f99");
 #if defined(__GNUC__) || defined(__clang__)
     static_assert(field_name<packed_element_size, 0> == "chif");
     static_assert(field_name<packed_element_size, 1> == "element");
@@ -310,6 +397,47 @@ TEST(field_reflection, field_name)
 #endif
 }
 
+TEST(field_reflection, field_names)
+{
+    static_assert(std::is_same_v<decltype(field_names<my_struct1>), const std::array<std::string_view, 5>&>);
+    static_assert(field_names<my_struct1>[2] == "hello");
+    static_assert(field_names<my_struct18>[99] == "f99");
+    static_assert(field_names<my_struct1>[3].data() == field_name<my_struct1, 3>.data());
+
+    // the names are packed into one buffer and terminated by NUL
+    const auto& names = field_names<my_struct1>;
+    for (std::size_t i = 0; i + 1 < names.size(); ++i)
+    {
+        EXPECT_EQ(names[i].data()[names[i].size()], '\0');
+        EXPECT_EQ(names[i].data() + names[i].size() + 1, names[i + 1].data());
+    }
+    EXPECT_STREQ(names[4].data(), "map");
+}
+
+TEST(field_reflection, field_index)
+{
+    static_assert(field_index<my_struct1>("i") == 0);
+    static_assert(field_index<my_struct1>("d") == 1);
+    static_assert(field_index<my_struct1>("hello") == 2);
+    static_assert(field_index<my_struct1>("arr") == 3);
+    static_assert(field_index<my_struct1>("map") == 4);
+    static_assert(field_index<my_struct1>("") == npos);
+    static_assert(field_index<my_struct1>("hell") == npos);
+    static_assert(field_index<my_struct1>("hello ") == npos);
+    static_assert(field_index<my_struct4>("i") == 0);
+    static_assert(field_index<my_struct4>("j") == npos);
+    static_assert([]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return ((field_index<my_struct18>(field_name<my_struct18, Is>) == Is) && ...);
+    }(std::make_index_sequence<field_count<my_struct18>>()));
+    static_assert(detail::field_index_table_value<my_struct1>.perfect);
+    static_assert(detail::field_index_table_value<my_struct18>.perfect);
+
+    const auto key = std::string("hello");
+    EXPECT_EQ(field_index<my_struct1>(key), 2);
+    EXPECT_EQ(field_index<my_struct1>(std::string("unknown")), npos);
+    EXPECT_EQ(field_index<named::my_struct10>(std::string("y0")), 1);
+}
+
 TEST(field_reflection, type_name)
 {
     static_assert(type_name<my_struct1> == "my_struct1");
@@ -423,6 +551,24 @@ TEST(field_reflection, get_field)
         static_assert(std::is_same_v<decltype(get_field<0>(ms11)), decltype(ms11.x1)&>);
         static_assert(std::is_same_v<decltype(get_field<1>(ms11)), decltype(ms11.y1)&>);
     }
+
+    {
+        // only the selected field is moved
+        auto ms1 = my_struct1{};
+        auto hello = get_field<2>(std::move(ms1));
+        EXPECT_EQ(hello, "Hello World");
+        EXPECT_TRUE(ms1.hello.empty());
+        EXPECT_EQ(ms1.map.size(), 2);
+        auto map = get_field<4>(std::move(ms1));
+        EXPECT_EQ(map.size(), 2);
+        EXPECT_TRUE(ms1.map.empty());
+
+        int i = 1;
+        double d = 3.14;
+        auto ms2 = my_struct2{i, d};
+        static_assert(std::is_same_v<decltype(get_field<0>(std::move(ms2))), int>);
+        EXPECT_EQ(get_field<0>(std::move(ms2)), 1);
+    }
 }
 
 TEST(field_reflection, to_tuple)
@@ -520,6 +666,17 @@ TEST(field_reflection, for_each_field)
                        EXPECT_EQ(*value1, 42);
                        EXPECT_EQ(*value2, 43);
                    });
+
+    // the fields of an rvalue are passed as rvalue references to the object itself
+    auto ms12 = my_struct12{std::make_unique<int>(42)};
+    const auto* address = &ms12.value;
+    for_each_field(std::move(ms12), [&](std::unique_ptr<int>&& value) { EXPECT_EQ(&value, address); });
+    EXPECT_NE(ms12.value, nullptr);
+    EXPECT_FALSE(any_of_field(std::move(ms12), [](auto&& value) { return value == nullptr; }));
+    auto moved = std::unique_ptr<int>();
+    for_each_field(std::move(ms12), [&](std::unique_ptr<int>&& value) { moved = std::move(value); });
+    EXPECT_EQ(*moved, 42);
+    EXPECT_EQ(ms12.value, nullptr);
 }
 
 TEST(field_reflection, all_of_field)
@@ -612,4 +769,408 @@ TEST(field_reflection, any_of_field)
                                  return name == "value" && *value1 == 42 && *value2 == 43;
                              }));
 }
+
+TEST(field_reflection, visit_field)
+{
+    auto ms1 = my_struct1{};
+    EXPECT_TRUE(visit_field(ms1, 0, [](auto& value) {
+        if constexpr (std::is_same_v<decltype(value), int&>) value = 1;
+    }));
+    EXPECT_EQ(ms1.i, 1);
+    EXPECT_TRUE(visit_field(ms1, 2, [](std::string_view name, auto& value) {
+        EXPECT_EQ(name, "hello");
+        if constexpr (std::is_same_v<decltype(value), std::string&>) value = "world";
+    }));
+    EXPECT_EQ(ms1.hello, "world");
+    EXPECT_FALSE(visit_field(ms1, 5, [](auto&) { FAIL(); }));
+
+    EXPECT_TRUE(visit_field(ms1, "d", [](auto& value) {
+        if constexpr (std::is_same_v<decltype(value), double&>) value = 2.5;
+    }));
+    EXPECT_EQ(ms1.d, 2.5);
+    EXPECT_TRUE(visit_field(ms1, std::string("arr"), [](std::string_view name, const auto& value) {
+        EXPECT_EQ(name, "arr");
+        EXPECT_TRUE((std::is_same_v<std::remove_cvref_t<decltype(value)>, std::array<uint64_t, 3>>));
+    }));
+    EXPECT_FALSE(visit_field(ms1, "unknown", [](auto&) { FAIL(); }));
+
+    const auto& ms1cr = ms1;
+    auto visited = std::size_t{0};
+    for (std::size_t i = 0; i < field_count<my_struct1>; ++i)
+    {
+        EXPECT_TRUE(visit_field(ms1cr, i, [&](const auto&) { ++visited; }));
+    }
+    EXPECT_EQ(visited, field_count<my_struct1>);
+
+    auto ms3 = my_struct3{};
+    EXPECT_TRUE(visit_field(ms3, 1, [](const auto& value) { EXPECT_EQ(value, 3.14); }));
+
+    auto ms15 = my_struct15{};
+    EXPECT_FALSE(visit_field(ms15, 0, [](auto&) { FAIL(); }));
+
+    auto ptr = std::unique_ptr<int>();
+    EXPECT_TRUE(visit_field(my_struct12{std::make_unique<int>(42)}, "value",
+                            [&](std::unique_ptr<int>&& value) { ptr = std::move(value); }));
+    EXPECT_EQ(*ptr, 42);
+}
+
+template <std::size_t N, typename T>
+std::size_t runtime_field_offset(T& t)
+{
+    return static_cast<std::size_t>(reinterpret_cast<const char*>(std::addressof(get_field<N>(t))) -
+                                    reinterpret_cast<const char*>(std::addressof(t)));
+}
+
+TEST(field_reflection, layout)
+{
+    static_assert(field_layoutable<my_struct1>);
+    static_assert(field_layoutable<my_struct4>);
+    static_assert(field_layoutable<my_struct15>);
+    static_assert(field_layoutable<my_struct18>);
+    static_assert(field_layoutable<my_struct19>);
+    static_assert(!field_layoutable<my_struct6>);
+    static_assert(!field_layoutable<my_struct17>);
+    static_assert(!field_layoutable<my_struct20>);
+    static_assert(!field_layoutable<over_aligned_gap>);
+    static_assert(field_layoutable<trivial_layout>);
+    static_assert(field_layout_proven<trivial_layout>);
+    static_assert(!field_layout_proven<my_struct1>);
+    static_assert(!field_layout_proven<my_struct4>);
+    static_assert(field_layoutable<over_aligned_string> && !field_layout_proven<over_aligned_string>);
+    EXPECT_TRUE(layout_verified<trivial_layout>());
+    EXPECT_TRUE(layout_verified<my_struct1>());
+    EXPECT_TRUE(layout_verified<my_struct4>());
+    EXPECT_FALSE(layout_verified<over_aligned_string>());
+
+    auto ms1 = my_struct1{};
+    EXPECT_EQ(runtime_field_offset<0>(ms1), (field_offset<my_struct1, 0>));
+    EXPECT_EQ(runtime_field_offset<1>(ms1), (field_offset<my_struct1, 1>));
+    EXPECT_EQ(runtime_field_offset<2>(ms1), (field_offset<my_struct1, 2>));
+    EXPECT_EQ(runtime_field_offset<3>(ms1), (field_offset<my_struct1, 3>));
+    EXPECT_EQ(runtime_field_offset<4>(ms1), (field_offset<my_struct1, 4>));
+    static_assert(field_size<my_struct1, 2> == sizeof(std::string));
+    static_assert(padding_bytes<my_struct1> == field_offset<my_struct1, 1> - sizeof(int));
+
+    auto tl = trivial_layout{};
+    EXPECT_EQ(runtime_field_offset<0>(tl), (field_offset<trivial_layout, 0>));
+    EXPECT_EQ(runtime_field_offset<1>(tl), (field_offset<trivial_layout, 1>));
+    EXPECT_EQ(runtime_field_offset<2>(tl), (field_offset<trivial_layout, 2>));
+    EXPECT_EQ(runtime_field_offset<3>(tl), (field_offset<trivial_layout, 3>));
+    static_assert(field_size<trivial_layout, 3> == sizeof(my_struct19));
+    static_assert(layout<trivial_layout>.size() == 4);
+    static_assert(layout<trivial_layout>[2].offset == field_offset<trivial_layout, 2>);
+    static_assert(layout<trivial_layout>[2].size == sizeof(std::array<uint64_t, 3>));
+    static_assert(layout<trivial_layout>[2].alignment == alignof(std::array<uint64_t, 3>));
+    static_assert(padding_bytes<trivial_layout> == sizeof(trivial_layout) - sizeof(int) - sizeof(double) -
+                                                       sizeof(std::array<uint64_t, 3>) - sizeof(my_struct19));
+
+    static_assert(field_size<my_struct2, 0> == sizeof(int*));
+    static_assert(field_size<my_struct2, 1> == sizeof(double*));
+
+    static_assert(field_offset<my_struct19, 0> == 0);
+    static_assert(field_offset<my_struct19, 1> == alignof(int));
+    static_assert(field_offset<my_struct19, 2> == alignof(int) + sizeof(int));
+    static_assert(padding_bytes<my_struct19> == sizeof(my_struct19) - 2 - sizeof(int));
+    static_assert(has_padding<my_struct19>);
+
+    static_assert(layout<my_struct15>.empty());
+    static_assert(padding_bytes<my_struct15> == 1);
+
+    auto ms18 = my_struct18{};
+    EXPECT_EQ(runtime_field_offset<99>(ms18), (field_offset<my_struct18, 99>));
+    static_assert(!has_padding<my_struct18>);
+
+#if defined(__GNUC__) || defined(__clang__)
+    static_assert(field_layoutable<packed_element_size>);
+    static_assert(field_offset<packed_element_size, 0> == 0);
+    static_assert(field_offset<packed_element_size, 1> == 2);
+    static_assert(field_offset<packed_element_size, 2> == 10);
+    static_assert(!has_padding<packed_element_size>);
+#endif
+}
+
+// struct with unique object representations
+struct my_struct21
+{
+    uint32_t a;
+    uint32_t b;
+    std::array<uint64_t, 5> c;
+};
+
+// nested type with its own equality and hash
+struct case_insensitive_char
+{
+    char c;
+    static char fold(char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; }
+    bool operator==(const case_insensitive_char& other) const { return fold(c) == fold(other.c); }
+};
+
+template <>
+struct std::hash<case_insensitive_char>
+{
+    std::size_t operator()(const case_insensitive_char& x) const noexcept
+    {
+        return std::hash<char>{}(case_insensitive_char::fold(x.c));
+    }
+};
+
+struct tagged_char
+{
+    uint8_t id;
+    case_insensitive_char tag;
+};
+
+TEST(field_reflection, hash)
+{
+    static_assert(std::has_unique_object_representations_v<my_struct21>);
+    auto ms21_a = my_struct21{1, 2, {3, 4, 5, 6, 7}};
+    auto ms21_b = ms21_a;
+    EXPECT_EQ(hash(ms21_a), hash(ms21_b));
+    ms21_b.c[4] = 8;
+    EXPECT_NE(hash(ms21_a), hash(ms21_b));
+    ms21_b = ms21_a;
+    ms21_b.a = 2;
+    EXPECT_NE(hash(ms21_a), hash(ms21_b));
+
+    auto ms1_a = my_struct1{};
+    auto ms1_b = my_struct1{};
+    EXPECT_EQ(hash(ms1_a), hash(ms1_b));
+    ms1_b.map["three"] = 3;
+    EXPECT_NE(hash(ms1_a), hash(ms1_b));
+    ms1_b = ms1_a;
+    ms1_b.arr[2] = 4;
+    EXPECT_NE(hash(ms1_a), hash(ms1_b));
+    ms1_b = ms1_a;
+    ms1_b.d = -0.0;
+    ms1_a.d = 0.0;
+    EXPECT_EQ(hash(ms1_a), hash(ms1_b));
+
+    auto ms5_a = my_struct5{};
+    auto ms5_b = my_struct5{};
+    EXPECT_EQ(hash(ms5_a), hash(ms5_b));
+    ms5_b.m.hello = "world";
+    EXPECT_NE(hash(ms5_a), hash(ms5_b));
+
+    EXPECT_EQ(hash(my_struct15{}), hash(my_struct15{}));
+
+    // not hashed over the bytes as the nested type has its own operator==
+    static_assert(std::has_unique_object_representations_v<tagged_char>);
+    EXPECT_EQ(hash(tagged_char{1, {'a'}}), hash(tagged_char{1, {'A'}}));
+    EXPECT_NE(hash(tagged_char{1, {'a'}}), hash(tagged_char{1, {'b'}}));
+
+    auto set = std::unordered_set<my_struct1, hasher>{};
+    set.insert(my_struct1{});
+    set.insert(my_struct1{});
+    set.insert(my_struct1{.i = 0});
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_TRUE(set.contains(my_struct1{.i = 0}));
+}
+
+// structs with opt-in comparison operators
+namespace compared
+{
+    using field_reflection::operators::operator==;
+    using field_reflection::operators::operator<=>;
+
+    struct key
+    {
+        std::array<uint8_t, 4> tag;
+        uint16_t x;
+        uint16_t y;
+        uint32_t z;
+    };
+
+    struct record
+    {
+        key k;
+        double weight;
+        std::string name;
+    };
+}  // namespace compared
+
+TEST(field_reflection, fields_equal)
+{
+    static_assert(fields_equality_comparable<my_struct21>);
+    static_assert(!fields_equality_comparable<my_struct14>);
+
+    auto ms21_a = my_struct21{1, 2, {3, 4, 5, 6, 7}};
+    auto ms21_b = ms21_a;
+    EXPECT_TRUE(fields_equal(ms21_a, ms21_b));
+    ms21_b.c[4] = 8;
+    EXPECT_FALSE(fields_equal(ms21_a, ms21_b));
+
+    auto ms1_a = my_struct1{};
+    auto ms1_b = my_struct1{};
+    EXPECT_TRUE(fields_equal(ms1_a, ms1_b));
+    ms1_b.hello = "world";
+    EXPECT_FALSE(fields_equal(ms1_a, ms1_b));
+
+    auto ms19_a = my_struct19{'a', 1, 'b'};
+    auto ms19_b = ms19_a;
+    std::memset(&ms19_b, 0xff, sizeof(ms19_b));
+    ms19_b.c = 'a';
+    ms19_b.i = 1;
+    ms19_b.c2 = 'b';
+    EXPECT_TRUE(fields_equal(ms19_a, ms19_b));
+
+    // the integer prefix of a struct with a string is compared by one memcmp
+    struct mixed
+    {
+        int32_t a;
+        int32_t b;
+        int64_t c;
+        std::string s;
+        uint8_t u0;
+        uint8_t u1;
+    };
+    static_assert(detail::equality_segments<mixed>.second == 3);
+    static_assert(detail::ordering_segments<mixed>.second == 5);
+    EXPECT_TRUE(fields_equal(mixed{1, 2, 3, "x", 4, 5}, mixed{1, 2, 3, "x", 4, 5}));
+    EXPECT_FALSE(fields_equal(mixed{1, 2, 3, "x", 4, 5}, mixed{1, 2, 4, "x", 4, 5}));
+    EXPECT_FALSE(fields_equal(mixed{1, 2, 3, "x", 4, 5}, mixed{1, 2, 3, "y", 4, 5}));
+    EXPECT_FALSE(fields_equal(mixed{1, 2, 3, "x", 4, 5}, mixed{1, 2, 3, "x", 4, 6}));
+    EXPECT_EQ(fields_compare(mixed{1, 2, 3, "x", 4, 5}, mixed{1, 2, 3, "x", 4, 6}), std::strong_ordering::less);
+    EXPECT_EQ(fields_compare(mixed{1, 2, 3, "x", 5, 0}, mixed{1, 2, 3, "x", 4, 6}), std::strong_ordering::greater);
+
+    // merged fields fall back to field-wise comparison when the layout is refuted at run time
+    ASSERT_FALSE(layout_verified<over_aligned_string>());
+    static_assert(detail::equality_segments<over_aligned_string>.second < 5);
+    EXPECT_TRUE(fields_equal(over_aligned_string{1, 2, 3, 4, "s"}, over_aligned_string{1, 2, 3, 4, "s"}));
+    EXPECT_FALSE(fields_equal(over_aligned_string{1, 2, 3, 4, "s"}, over_aligned_string{1, 2, 99, 4, "s"}));
+
+    // fields are not merged into one memcmp when the derived offsets are wrong
+    EXPECT_TRUE(fields_equal(over_aligned_gap{1, 2, 3, 4}, over_aligned_gap{1, 2, 3, 4}));
+    EXPECT_FALSE(fields_equal(over_aligned_gap{1, 2, 3, 4}, over_aligned_gap{1, 2, 99, 4}));
+    EXPECT_FALSE(fields_equal(over_aligned_gap{1, 2, 3, 4}, over_aligned_gap{1, 2, 3, 5}));
+
+    auto i = 1;
+    auto j = 1;
+    EXPECT_TRUE(fields_equal(my_struct3{i, 3.14}, my_struct3{j, 3.14}));
+    EXPECT_TRUE(fields_equal(my_struct15{}, my_struct15{}));
+    static_assert(fields_equal(compared::key{{1, 2, 3, 4}, 5, 6, 7}, compared::key{{1, 2, 3, 4}, 5, 6, 7}));
+    static_assert(!fields_equal(compared::key{{1, 2, 3, 4}, 5, 6, 7}, compared::key{{1, 2, 3, 4}, 5, 6, 8}));
+
+    auto r1 = compared::record{{{1, 2, 3, 4}, 5, 6, 7}, 1.0, "a"};
+    auto r2 = r1;
+    EXPECT_TRUE(r1 == r2);
+    r2.k.tag[3] = 0;
+    EXPECT_TRUE(r1 != r2);
+}
+
+TEST(field_reflection, fields_compare)
+{
+    static_assert(std::is_same_v<decltype(fields_compare(my_struct21{}, my_struct21{})), std::strong_ordering>);
+    static_assert(
+        std::is_same_v<decltype(fields_compare(my_struct1{}, my_struct1{})), std::partial_ordering>);
+    static_assert(fields_compare(my_struct15{}, my_struct15{}) == 0);
+
+    auto ms21_a = my_struct21{1, 2, {3, 4, 5, 6, 7}};
+    auto ms21_b = ms21_a;
+    EXPECT_TRUE(fields_compare(ms21_a, ms21_b) == 0);
+    ms21_b.a = 0;
+    ms21_b.c[0] = 0xffff;
+    EXPECT_TRUE(fields_compare(ms21_a, ms21_b) > 0);
+
+    auto ms1_a = my_struct1{};
+    auto ms1_b = my_struct1{};
+    ms1_b.hello = "Hello Xorld";
+    EXPECT_TRUE(fields_compare(ms1_a, ms1_b) < 0);
+
+    auto k1 = compared::key{{1, 2, 3, 4}, 0x0100, 0, 0};
+    auto k2 = compared::key{{1, 2, 3, 5}, 0x0001, 0, 0};
+    static_assert(compared::key{{1, 2, 3, 4}, 5, 6, 7} < compared::key{{1, 2, 4, 0}, 0, 0, 0});
+    EXPECT_TRUE(k1 < k2);
+    k2.tag[3] = 4;
+    EXPECT_TRUE(k1 > k2);
+    k2.x = 0x0100;
+    EXPECT_TRUE(k1 == k2);
+    EXPECT_TRUE((k1 <=> k2) == 0);
+
+    auto r1 = compared::record{k1, 1.0, "a"};
+    auto r2 = compared::record{k1, 1.0, "b"};
+    static_assert(std::is_same_v<decltype(r1 <=> r2), std::partial_ordering>);
+    EXPECT_TRUE(r1 < r2);
+    r2.weight = 0.5;
+    EXPECT_TRUE(r1 > r2);
+}
+
+namespace leaves
+{
+    struct point
+    {
+        double x;
+        double y;
+    };
+
+    struct segment
+    {
+        point from;
+        point to;
+    };
+
+    struct shape
+    {
+        std::string name;
+        segment edge;
+        std::vector<point> vertices;
+        std::array<int, 2> ids;
+    };
+}  // namespace leaves
+
+TEST(field_reflection, for_each_leaf_field)
+{
+    static_assert(leaf_field_count<leaves::shape> == 7);
+    static_assert(leaf_path<leaves::shape, 0> == "name");
+    static_assert(leaf_path<leaves::shape, 3> == "edge.to.x");
+    static_assert(leaf_path<leaves::shape, 6> == "ids");
+
+    auto s = leaves::shape{"line", {{1.0, 2.0}, {3.0, 4.0}}, {{5.0, 6.0}}, {7, 8}};
+    auto paths = std::vector<std::string_view>{};
+    auto indices = std::vector<std::size_t>{};
+    for_each_leaf_field(s, [&](std::string_view path, auto index, auto& field) {
+        static_assert(leaf_path<leaves::shape, decltype(index)::value>.size() > 0);
+        paths.push_back(path);
+        indices.push_back(index);
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(field)>, double>) field *= 10;
+    });
+    EXPECT_EQ(paths, (std::vector<std::string_view>{"name", "edge.from.x", "edge.from.y", "edge.to.x", "edge.to.y",
+                                                    "vertices", "ids"}));
+    EXPECT_EQ(indices, (std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(s.edge.to.y, 40.0);
+    EXPECT_EQ(s.vertices[0].x, 5.0);
+
+    // the same static storage is passed on every call
+    auto first = std::string_view{};
+    for_each_leaf_field(std::as_const(s), [&](std::string_view path, const auto&) {
+        if (first.empty()) first = path;
+    });
+    EXPECT_EQ(first.data(), paths[0].data());
+
+    auto name = std::string{};
+    for_each_leaf_field(std::move(s), [&](std::string_view path, auto&& field) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(field)>, std::string>)
+        {
+            static_assert(std::is_rvalue_reference_v<decltype(field)>);
+            name = std::move(field);
+        }
+        EXPECT_FALSE(path.empty());
+    });
+    EXPECT_EQ(name, "line");
+}
+
+TEST(field_reflection, schema_hash)
+{
+    constexpr auto h = schema_hash<leaves::segment>;
+    static_assert(h == schema_hash<leaves::segment>);
+    static_assert(schema_hash<const leaves::segment> == h);
+    static_assert(schema_hash<leaves::point> != h);
+    static_assert(schema_hash<leaves::shape> != h);
+    static_assert(schema_hash<std::array<leaves::point, 2>> != schema_hash<std::array<leaves::segment, 2>>);
+    static_assert(schema_hash<int> != schema_hash<unsigned int>);
+
+    auto hashes = std::unordered_set<std::uint64_t>{schema_hash<leaves::point>, schema_hash<leaves::segment>,
+                                                    schema_hash<leaves::shape>, schema_hash<my_struct1>,
+                                                    schema_hash<my_struct5>, schema_hash<my_struct21>};
+    EXPECT_EQ(hashes.size(), 6);
+}
 // NOLINTEND
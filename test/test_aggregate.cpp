@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+#include "field_reflection/aggregate.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+struct trade
+{
+    std::int64_t id;
+    double price;
+    std::string symbol;
+    std::uint32_t quantity;
+    float fee;
+};
+
+static_assert(std::is_same_v<aggregate_result<trade, summary_reducer>,
+                             std::tuple<field_summary<std::int64_t>, field_summary<double>, std::monostate,
+                                        field_summary<std::uint32_t>, field_summary<float>>>);
+
+std::vector<trade> make_trades(std::size_t n)
+{
+    auto trades = std::vector<trade>();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        trades.push_back({static_cast<std::int64_t>(i) - 1000, 0.5 * static_cast<double>(i % 1000), "x",
+                          static_cast<std::uint32_t>(i % 7), 0.25f});
+    }
+    return trades;
+}
+
+TEST(aggregate, summary)
+{
+    const auto trades = make_trades(100000);
+    const auto result = aggregate_fields(std::span(trades), summary_reducer{}, 1);
+
+    const auto& id = std::get<0>(result);
+    EXPECT_EQ(id.count, 100000);
+    EXPECT_EQ(id.min, -1000);
+    EXPECT_EQ(id.max, 98999);
+    EXPECT_EQ(id.sum, 100000LL * 99999 / 2 - 1000LL * 100000);
+
+    const auto& price = std::get<1>(result);
+    EXPECT_EQ(price.min, 0.0);
+    EXPECT_EQ(price.max, 499.5);
+    EXPECT_DOUBLE_EQ(price.mean(), 249.75);
+
+    const auto& quantity = std::get<3>(result);
+    EXPECT_EQ(quantity.max, 6);
+    EXPECT_EQ(std::get<4>(result).sum, 25000.0);
+}
+
+TEST(aggregate, threads)
+{
+    const auto trades = make_trades(300007);
+    const auto sequential = aggregate_fields(std::span(trades), summary_reducer{}, 1);
+    for (auto threads : {2, 3, 8, 64})
+    {
+        const auto parallel = aggregate_fields(std::span(trades), summary_reducer{}, threads);
+        EXPECT_EQ(std::get<0>(parallel).sum, std::get<0>(sequential).sum);
+        EXPECT_EQ(std::get<0>(parallel).min, std::get<0>(sequential).min);
+        EXPECT_EQ(std::get<0>(parallel).max, std::get<0>(sequential).max);
+        EXPECT_EQ(std::get<3>(parallel).count, trades.size());
+        EXPECT_DOUBLE_EQ(std::get<1>(parallel).sum, std::get<1>(sequential).sum);
+    }
+}
+
+TEST(aggregate, empty)
+{
+    const auto trades = std::vector<trade>();
+    const auto result = aggregate_fields(std::span(trades));
+    EXPECT_EQ(std::get<1>(result).count, 0);
+    EXPECT_TRUE(std::isnan(std::get<1>(result).mean()));
+}
+
+// the number of non-zero values
+struct nonzero_reducer
+{
+    template <typename T>
+    std::size_t init() const
+    {
+        return 0;
+    }
+
+    template <typename T>
+    void operator()(std::size_t& acc, T value) const
+    {
+        if (value != T{}) ++acc;
+        if constexpr (std::is_same_v<T, float>)
+        {
+            if (std::isnan(value)) throw std::domain_error("NaN");
+        }
+    }
+
+    void merge(std::size_t& acc, std::size_t other) const { acc += other; }
+};
+
+TEST(aggregate, reducer)
+{
+    auto trades = make_trades(50000);
+    const auto result = aggregate_fields(std::span(trades), nonzero_reducer{}, 4);
+    EXPECT_EQ(std::get<0>(result), 49999);
+    EXPECT_EQ(std::get<3>(result), 50000 - (50000 + 6) / 7);
+
+    trades[40000].fee = std::nanf("");
+    EXPECT_THROW(aggregate_fields(std::span(trades), nonzero_reducer{}, 4), std::domain_error);
+}
+// NOLINTEND
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "field_reflection/column.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+struct tick
+{
+    double price;
+    float weight;
+    std::int32_t volume;
+    std::int64_t id;
+    char flag;
+};
+
+struct named
+{
+    std::string name;
+    int value;
+};
+
+static_assert(std::ranges::random_access_range<field_column_view<tick, 0>>);
+static_assert(std::ranges::random_access_range<field_column_view<const tick, 0>>);
+static_assert(std::ranges::sized_range<field_column_view<tick, 0>>);
+static_assert(std::is_same_v<std::ranges::range_reference_t<field_column_view<tick, 2>>, std::int32_t&>);
+static_assert(std::is_same_v<std::ranges::range_reference_t<field_column_view<const tick, 2>>, const std::int32_t&>);
+
+static std::vector<tick> make_ticks(std::size_t n)
+{
+    auto rows = std::vector<tick>(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto v = static_cast<std::int32_t>((i * 7919) % 1000) - 500;
+        rows[i] = tick{v * 0.5, static_cast<float>(v) * 0.25f, v, static_cast<std::int64_t>(i) * v, 'a'};
+    }
+    return rows;
+}
+
+TEST(column, view)
+{
+    auto rows = make_ticks(10);
+    auto prices = field_column<0>(std::span(rows));
+    EXPECT_EQ(prices.size(), 10);
+    EXPECT_EQ(&prices[3], &rows[3].price);
+    EXPECT_EQ(prices.end() - prices.begin(), 10);
+
+    for (auto& price : prices) price = 1.0;
+    EXPECT_TRUE(std::ranges::all_of(rows, [](const auto& r) { return r.price == 1.0; }));
+
+    auto ids = field_column<3>(std::span<const tick>(rows));
+    auto it = ids.begin();
+    it += 4;
+    EXPECT_EQ(*it, rows[4].id);
+    EXPECT_EQ(it[-1], rows[3].id);
+    EXPECT_LT(ids.begin(), it);
+
+    auto names = std::vector<named>{{"a", 1}, {"b", 2}};
+    auto joined = std::string{};
+    for (const auto& name : field_column<0>(std::span(names))) joined += name;
+    EXPECT_EQ(joined, "ab");
+}
+
+TEST(column, reduce)
+{
+    for (auto n : {0u, 1u, 7u, 64u, 1000u, 1027u})
+    {
+        auto rows = make_ticks(n);
+        auto span = std::span<const tick>(rows);
+        auto price = 0.0;
+        auto weight = 0.0f;
+        auto volume = std::int32_t{0};
+        auto id = std::int64_t{0};
+        for (const auto& r : rows)
+        {
+            price += r.price;
+            weight += r.weight;
+            volume += r.volume;
+            id += r.id;
+        }
+        EXPECT_DOUBLE_EQ(reduce_field<0>(span), price);
+        EXPECT_NEAR(reduce_field<1>(span), weight, 1e-3);
+        EXPECT_EQ(reduce_field<2>(span), volume);
+        EXPECT_EQ(reduce_field<3>(span), id);
+        EXPECT_EQ(reduce_field<2>(span, std::int64_t{10}), volume + 10);
+        EXPECT_EQ(reduce_field<4>(std::span(rows), 0), static_cast<int>(n) * 'a');
+    }
+
+    auto names = std::vector<named>{{"a", 1}, {"b", 2}};
+    EXPECT_EQ(reduce_field<0>(std::span(names), std::string("x")), "xab");
+}
+
+TEST(column, min)
+{
+    EXPECT_EQ(min_field<0>(std::span<const tick>{}), std::nullopt);
+    for (auto n : {1u, 9u, 1000u, 1027u})
+    {
+        auto rows = make_ticks(n);
+        auto span = std::span<const tick>(rows);
+        auto expected = std::ranges::min(rows, {}, &tick::volume);
+        EXPECT_EQ(min_field<0>(span), expected.price);
+        EXPECT_EQ(min_field<1>(span), expected.weight);
+        EXPECT_EQ(min_field<2>(span), expected.volume);
+        EXPECT_EQ(min_field<3>(span), std::ranges::min(rows, {}, &tick::id).id);
+    }
+
+    auto rows = make_ticks(100);
+    rows[0].price = std::numeric_limits<double>::quiet_NaN();
+    rows[50].price = std::numeric_limits<double>::quiet_NaN();
+    rows[99].price = -1000.0;
+    EXPECT_EQ(min_field<0>(std::span(rows)), -1000.0);
+
+    for (auto& r : rows) r.price = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(min_field<0>(std::span(rows)), std::nullopt);
+    rows[10].price = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(min_field<0>(std::span(rows)), std::numeric_limits<double>::infinity());
+
+    auto names = std::vector<named>{{"b", 1}, {"a", 2}, {"c", 3}};
+    EXPECT_EQ(min_field<0>(std::span(names)), "a");
+}
+
+TEST(column, count_if)
+{
+    for (auto n : {0u, 5u, 64u, 1000u, 1027u})
+    {
+        auto rows = make_ticks(n);
+        auto span = std::span<const tick>(rows);
+        auto positive = [](const auto& v) { return v > 0; };
+        EXPECT_EQ(count_if_field<0>(span, positive), std::ranges::count_if(rows, positive, &tick::price));
+        EXPECT_EQ(count_if_field<1>(span, positive), std::ranges::count_if(rows, positive, &tick::weight));
+        EXPECT_EQ(count_if_field<2>(span, positive), std::ranges::count_if(rows, positive, &tick::volume));
+        EXPECT_EQ(count_if_field<3>(span, positive), std::ranges::count_if(rows, positive, &tick::id));
+        EXPECT_EQ(count_if_field<4>(span, [](char c) { return c == 'a'; }), n);
+    }
+
+    auto calls = 0;
+    auto rows = make_ticks(200);
+    count_if_field<2>(std::span(rows), [&](std::int32_t) {
+        ++calls;
+        return true;
+    });
+    EXPECT_EQ(calls, 200);
+}
+// NOLINTEND
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "field_reflection/csv.hpp"
+#include "field_reflection/soa_vector.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+struct trade
+{
+    std::uint64_t id;
+    std::string symbol;
+    double price;
+    std::int32_t quantity;
+    bool buy;
+    std::optional<std::string> note;
+    char venue;
+};
+
+static std::span<const char> text(std::string_view s) { return {s.data(), s.size()}; }
+
+TEST(csv, load)
+{
+    const auto rows = load_csv<trade>(text("id,symbol,price,quantity,buy,note,venue\n"
+                                           "1,AAPL,189.5,100,1,open,N\n"
+                                           "2,\"BRK,B\",412.25,-5,false,,X\r\n"
+                                           "\n"
+                                           "3,\"say \"\"hi\"\"\",1e3,0,true,\"\",Q"));
+    ASSERT_EQ(rows.size(), 3);
+    EXPECT_EQ(rows[0].id, 1);
+    EXPECT_EQ(rows[0].symbol, "AAPL");
+    EXPECT_EQ(rows[0].price, 189.5);
+    EXPECT_EQ(rows[0].quantity, 100);
+    EXPECT_TRUE(rows[0].buy);
+    EXPECT_EQ(rows[0].note, "open");
+    EXPECT_EQ(rows[0].venue, 'N');
+    EXPECT_EQ(rows[1].symbol, "BRK,B");
+    EXPECT_EQ(rows[1].quantity, -5);
+    EXPECT_FALSE(rows[1].buy);
+    EXPECT_EQ(rows[1].note, std::nullopt);
+    EXPECT_EQ(rows[1].venue, 'X');
+    EXPECT_EQ(rows[2].symbol, "say \"hi\"");
+    EXPECT_EQ(rows[2].note, "");
+    EXPECT_EQ(rows[2].price, 1000.0);
+
+    EXPECT_TRUE(load_csv<trade>(text("")).empty());
+    EXPECT_TRUE(load_csv<trade>(text("id,price\n")).empty());
+}
+
+TEST(csv, columns)
+{
+    // reordered, unknown and missing columns
+    const auto rows = load_csv<trade>(text("price\tcomment\tid\n1.5\tfirst\t10\n2.5\t\t20\n"), {.delimiter = '\t'});
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(rows[0].price, 1.5);
+    EXPECT_EQ(rows[0].id, 10);
+    EXPECT_EQ(rows[0].symbol, "");
+    EXPECT_EQ(rows[1].price, 2.5);
+    EXPECT_EQ(rows[1].id, 20);
+
+    const auto no_header = load_csv<trade>(text("7,MSFT,420,1,0,,Q\n"), {.header = false});
+    ASSERT_EQ(no_header.size(), 1);
+    EXPECT_EQ(no_header[0].symbol, "MSFT");
+    EXPECT_EQ(no_header[0].venue, 'Q');
+
+    // a doubled quote is unescaped by the quote of the options
+    const auto single = load_csv<trade>(text("id,symbol,note\n1,'x''y','say \"\"hi\"\"'\n"), {.quote = '\''});
+    ASSERT_EQ(single.size(), 1);
+    EXPECT_EQ(single[0].symbol, "x'y");
+    EXPECT_EQ(single[0].note, "say \"\"hi\"\"");
+}
+
+TEST(csv, errors)
+{
+    try
+    {
+        (void)load_csv<trade>(text("id,price\n1,2\n2,abc\n"));
+        FAIL();
+    }
+    catch (const csv_error& e)
+    {
+        EXPECT_EQ(std::string_view(e.what()), "invalid value 'abc' of column price in row 2");
+    }
+    EXPECT_THROW((void)load_csv<trade>(text("id\n1x\n")), csv_error);
+    EXPECT_THROW((void)load_csv<trade>(text("symbol\n\"open\n")), csv_error);
+    EXPECT_THROW((void)load_csv<trade>(text("symbol,id\n\"a\"b,1\n")), csv_error);
+    EXPECT_THROW((void)load_csv<trade>(std::filesystem::path("no_such_file.csv")), std::system_error);
+
+    // short and long rows
+    try
+    {
+        (void)load_csv<trade>(text("price,comment,id\n1.5,first,10\n3.5\n"));
+        FAIL();
+    }
+    catch (const csv_error& e)
+    {
+        EXPECT_EQ(std::string_view(e.what()), "missing column comment in row 2");
+    }
+    EXPECT_THROW((void)load_csv<trade>(text("price,id\n1.5,10,\n")), csv_error);
+    EXPECT_THROW((void)load_csv<trade>(text("7,MSFT,420,1,0,,Q,extra\n"), {.header = false}), csv_error);
+    EXPECT_THROW((void)load_csv<trade>(text("7,MSFT,420,1,0,,\n"), {.header = false}), csv_error);
+}
+
+TEST(csv, threads)
+{
+    auto input = std::string("id,symbol,price,quantity\n");
+    constexpr auto n = 200000;
+    for (int i = 0; i < n; ++i)
+    {
+        input += std::to_string(i) + ",S" + std::to_string(i % 100) + "," + std::to_string(i * 0.5) + "," +
+                 std::to_string(-i) + "\n";
+    }
+    ASSERT_GT(input.size(), std::size_t{4} << 20);
+
+    const auto rows = load_csv<trade>(text(input), {.threads = 4});
+    ASSERT_EQ(rows.size(), n);
+    for (int i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(rows[i].id, static_cast<std::uint64_t>(i));
+        ASSERT_EQ(rows[i].quantity, -i);
+    }
+    EXPECT_EQ(rows[n - 1].symbol, "S99");
+
+    const auto columns = load_csv<trade, soa_vector<trade>>(text(input), {.threads = 3});
+    ASSERT_EQ(columns.size(), n);
+    EXPECT_EQ(columns.column<0>()[n - 1], n - 1);
+    EXPECT_EQ(columns.column<3>()[12345], -12345);
+    EXPECT_EQ(get_field<1>(columns[77]), "S77");
+
+    const auto path = std::filesystem::temp_directory_path() / "field_reflection_csv_threads.csv";
+    {
+        auto out = std::ofstream(path, std::ios::binary);
+        out << input;
+    }
+    const auto from_file = load_csv<trade>(path, {.threads = 2});
+    std::filesystem::remove(path);
+    ASSERT_EQ(from_file.size(), n);
+    EXPECT_EQ(from_file[n / 2].price, rows[n / 2].price);
+}
+// NOLINTEND
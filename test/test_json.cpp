@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "field_reflection/json.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+enum class color : std::uint8_t
+{
+    red = 1,
+    green = 2,
+};
+
+struct point
+{
+    double x;
+    double y;
+};
+
+struct record
+{
+    int id;
+    bool active;
+    std::string name;
+    point position;
+    std::vector<int> values;
+    std::map<std::string, double> scores;
+    std::optional<std::string> comment;
+    color c;
+    std::array<std::uint8_t, 2> bytes;
+    std::tuple<int, std::string> pair;
+    std::map<int, bool> flags;
+    char grade;
+};
+
+TEST(json, key_fragments)
+{
+    using keys = detail::json_key_fragments<point>;
+    EXPECT_EQ((std::string_view(keys::chars.data(), keys::chars.size())), R"({"x":,"y":})");
+    EXPECT_EQ(keys::fragment<0>, R"({"x":)");
+    EXPECT_EQ(keys::fragment<1>, R"(,"y":)");
+    EXPECT_EQ(keys::fragment<2>, "}");
+}
+
+TEST(json, to_json)
+{
+    EXPECT_EQ(to_json(point{1.5, -2.0}), R"({"x":1.5,"y":-2})");
+
+    auto r = record{
+        .id = 42,
+        .active = true,
+        .name = "field \"reflection\"\n",
+        .position = {0.25, 1e100},
+        .values = {1, 2, 3},
+        .scores = {{"a", 0.5}, {"b", 1.0}},
+        .comment = std::nullopt,
+        .c = color::green,
+        .bytes = {7, 8},
+        .pair = {1, "one"},
+        .flags = {{3, true}},
+        .grade = 'A',
+    };
+    EXPECT_EQ(to_json(r),
+              R"({"id":42,"active":true,"name":"field \"reflection\"\n","position":{"x":0.25,"y":1e+100},)"
+              R"("values":[1,2,3],"scores":{"a":0.5,"b":1},"comment":null,"c":2,"bytes":[7,8],)"
+              R"("pair":[1,"one"],"flags":{"3":true},"grade":"A"})");
+
+    r.values.clear();
+    r.scores.clear();
+    r.comment = "\x01\t";
+    r.position.x = std::numeric_limits<double>::quiet_NaN();
+    const auto json = to_json(r);
+    EXPECT_NE(json.find(R"("values":[],"scores":{},"comment":"\u0001\t")"), std::string::npos);
+    EXPECT_NE(json.find(R"("x":null)"), std::string::npos);
+}
+
+struct keyed
+{
+    std::map<char, int> chars;
+    std::map<std::pair<int, std::string>, int> pairs;
+};
+
+TEST(json, map_keys)
+{
+    // keys other than strings are formatted as values and escaped
+    const auto k = keyed{{{'"', 1}, {'a', 2}}, {{{1, "x\\y"}, 3}}};
+    EXPECT_EQ(to_json(k), R"({"chars":{"\"":1,"a":2},"pairs":{"[1,\"x\\\\y\"]":3}})");
+
+    auto chars = std::vector<char>{};
+    to_json(k, chars);
+    EXPECT_EQ(std::string_view(chars.data(), chars.size()), to_json(k));
+}
+
+TEST(json, buffer)
+{
+    auto out = std::string("[");
+    to_json(point{1, 2}, out);
+    out += ",";
+    to_json(point{3, 4}, out);
+    out += "]";
+    EXPECT_EQ(out, R"([{"x":1,"y":2},{"x":3,"y":4}])");
+
+    auto chars = std::vector<char>{};
+    to_json(point{5, 6}, chars);
+    EXPECT_EQ(std::string_view(chars.data(), chars.size()), R"({"x":5,"y":6})");
+}
+
+struct node
+{
+    std::string name;
+    std::vector<node> children;
+};
+
+struct config
+{
+    std::string host;
+    std::uint16_t port;
+    bool secure;
+    std::vector<std::string> paths;
+    std::set<int> ids;
+    std::vector<bool> flags;
+    std::map<std::string, point> points;
+    std::unordered_map<int, double> weights;
+    std::optional<std::vector<point>> origins;
+    std::optional<std::string> note;
+    std::array<int, 3> triple;
+    std::tuple<int, std::string> pair;
+    color c;
+    char grade;
+    double ratio;
+};
+
+TEST(json, from_json)
+{
+    const auto p = from_json<point>(R"({"x":1.5,"y":-2})");
+    EXPECT_EQ(p.x, 1.5);
+    EXPECT_EQ(p.y, -2.0);
+
+    const auto c = from_json<config>(R"(
+        {
+            "host": "example.com\t\"é😀\"",
+            "port": 8080,
+            "secure": true,
+            "unknown": {"nested": [1, 2, {"deep": null}], "s": "\"}"},
+            "paths": ["/a", "/b"],
+            "ids": [3, 1, 2, 3],
+            "flags": [true, false, true],
+            "points": {"a": {"x": 1, "y": 2}, "b": {"y": 4}},
+            "weights": {"1": 0.5, "-2": 1e3},
+            "origins": [{"x": 5, "y": 6}],
+            "note": null,
+            "triple": [7, 8, 9],
+            "pair": [1, "one"],
+            "c": 2,
+            "grade": "A",
+            "ratio": -1.25e-2
+        }
+    )");
+    EXPECT_EQ(c.host, "example.com\t\"\xc3\xa9\xf0\x9f\x98\x80\"");
+    EXPECT_EQ(c.port, 8080);
+    EXPECT_TRUE(c.secure);
+    EXPECT_EQ(c.paths, (std::vector<std::string>{"/a", "/b"}));
+    EXPECT_EQ(c.ids, (std::set<int>{1, 2, 3}));
+    EXPECT_EQ(c.flags, (std::vector<bool>{true, false, true}));
+    EXPECT_EQ(c.points.at("a").y, 2.0);
+    EXPECT_EQ(c.points.at("b").y, 4.0);
+    EXPECT_EQ(c.weights.at(-2), 1000.0);
+    ASSERT_TRUE(c.origins.has_value());
+    EXPECT_EQ(c.origins->at(0).y, 6.0);
+    EXPECT_FALSE(c.note.has_value());
+    EXPECT_EQ(c.triple, (std::array<int, 3>{7, 8, 9}));
+    EXPECT_EQ(c.pair, (std::tuple<int, std::string>{1, "one"}));
+    EXPECT_EQ(c.c, color::green);
+    EXPECT_EQ(c.grade, 'A');
+    EXPECT_EQ(c.ratio, -1.25e-2);
+
+    const auto tree = from_json<node>(R"({"name":"root","children":[{"name":"a","children":[]},{"name":"b"}]})");
+    ASSERT_EQ(tree.children.size(), 2);
+    EXPECT_EQ(tree.children[1].name, "b");
+}
+
+TEST(json, round_trip)
+{
+    auto r = record{1, false, "name", {1, 2}, {1, 2}, {{"a", 1}}, "comment", color::red, {1, 2}, {3, "x"}, {}, 'z'};
+    const auto json = to_json(r);
+    const auto copy = from_json<record>(json);
+    EXPECT_EQ(to_json(copy), json);
+}
+
+TEST(json, json_reader)
+{
+    const auto json = std::string(R"({"host":"chunked \"input\"","port":443,"secure":false,"ratio":0.125,)"
+                                  R"("paths":["x","y"],"triple":[1,2,3],"note":"12345"})");
+    for (std::size_t chunk = 1; chunk <= json.size(); ++chunk)
+    {
+        auto c = config{};
+        auto reader = json_reader<config>(c);
+        for (std::size_t i = 0; i < json.size(); i += chunk)
+        {
+            EXPECT_FALSE(reader.done());
+            reader.feed(std::string_view(json).substr(i, chunk));
+        }
+        reader.finish();
+        EXPECT_TRUE(reader.done());
+        EXPECT_EQ(c.host, "chunked \"input\"");
+        EXPECT_EQ(c.port, 443);
+        EXPECT_EQ(c.ratio, 0.125);
+        EXPECT_EQ(c.paths, (std::vector<std::string>{"x", "y"}));
+        EXPECT_EQ(c.note, "12345");
+    }
+}
+
+TEST(json, error)
+{
+    EXPECT_THROW(from_json<point>(R"({"x":1,"y":2)"), json_error);
+    EXPECT_THROW(from_json<point>(R"({"x":1,"y":2}})"), json_error);
+    EXPECT_THROW(from_json<point>(R"({"x":"1"})"), json_error);
+    EXPECT_THROW(from_json<point>(R"({"x":1.0.0})"), json_error);
+    EXPECT_THROW(from_json<point>(R"({"x" 1})"), json_error);
+    EXPECT_THROW(from_json<point>(R"({"x":1,})"), json_error);
+    EXPECT_THROW(from_json<point>(R"([1, 2])"), json_error);
+    EXPECT_THROW(from_json<point>(R"({"x":tru})"), json_error);
+    EXPECT_THROW(from_json<config>(R"({"port":70000})"), json_error);
+    EXPECT_THROW(from_json<config>(R"({"triple":[1,2]})"), json_error);
+    EXPECT_THROW(from_json<config>(R"({"triple":[1,2,3,4]})"), json_error);
+    EXPECT_THROW(from_json<config>(R"({"host":"\x"})"), json_error);
+
+    try
+    {
+        from_json<point>(R"({"x": 1, "y": ?})");
+        FAIL();
+    }
+    catch (const json_error& e)
+    {
+        EXPECT_STREQ(e.what(), "unexpected character '?' at offset 14");
+    }
+}
+// NOLINTEND
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "field_reflection/mapped_records.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+struct point
+{
+    float x;
+    float y;
+};
+
+struct tick
+{
+    std::uint64_t timestamp;
+    double price;
+    point position;
+    std::int32_t volume;
+    char side;
+};
+
+struct other_tick
+{
+    std::uint64_t timestamp;
+    double price;
+};
+
+struct new_tick
+{
+    std::uint64_t timestamp;
+    double price;
+    std::int64_t volume;
+    float weight = 1.0f;
+};
+
+// an over-aligned member that does not change the size, whose derived offsets are wrong
+struct over_aligned_tick
+{
+    char a;
+    alignas(2) char b;
+    char c;
+    std::int32_t volume;
+};
+
+static_assert(mappable_record<tick>);
+static_assert(!mappable_record<std::string>);
+static_assert(!mappable_record<over_aligned_tick>);
+
+class mapped_records_test : public ::testing::Test
+{
+protected:
+    std::filesystem::path path;
+
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("field_reflection_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+                ".records");
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+};
+
+TEST(record_schema, make)
+{
+    const auto schema = make_record_schema<tick>();
+    EXPECT_EQ(schema.type_name, type_name<tick>);
+    EXPECT_EQ(schema.size, sizeof(tick));
+    EXPECT_EQ(schema.alignment, alignof(tick));
+    EXPECT_EQ(schema.hash, schema_hash<tick>);
+    ASSERT_EQ(schema.fields.size(), 5);
+    EXPECT_EQ(schema.fields[2].name, "position");
+    EXPECT_EQ(schema.fields[2].type_name, type_name<point>);
+    EXPECT_EQ(schema.fields[2].offset, offsetof(tick, position));
+    EXPECT_EQ(schema.fields[2].size, sizeof(point));
+    EXPECT_EQ(schema.fields[4].type_name, type_name<char>);
+    EXPECT_EQ(schema, make_record_schema<tick>());
+    EXPECT_NE(schema, make_record_schema<other_tick>());
+}
+
+TEST_F(mapped_records_test, append_and_read)
+{
+    {
+        auto file = mapped_records<tick>(path, record_file_mode::create);
+        EXPECT_TRUE(file.empty());
+        EXPECT_TRUE(file.records().empty());
+        file.append(tick{1, 100.5, {1.0f, 2.0f}, 10, 'b'});
+        auto batch = std::vector<tick>{};
+        for (std::uint64_t i = 2; i <= 1000; ++i) batch.push_back(tick{i, 100.0 + i, {}, int(i), 's'});
+        file.append(batch);
+        EXPECT_EQ(file.size(), 1000);
+        EXPECT_EQ(file[999].timestamp, 1000);
+        file.flush();
+    }
+
+    const auto file = mapped_records<tick>(path);
+    EXPECT_EQ(file.size(), 1000);
+    EXPECT_EQ(file.schema(), make_record_schema<tick>());
+    const auto records = file.records();
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.data()) % alignof(tick), 0);
+    EXPECT_EQ(records[0].position.y, 2.0f);
+    EXPECT_EQ(records[0].side, 'b');
+    auto sum = std::uint64_t{0};
+    for (const auto& r : file) sum += r.timestamp;
+    EXPECT_EQ(sum, 500500);
+
+    auto readonly = mapped_records<tick>(path);
+    EXPECT_THROW(readonly.append(tick{}), std::logic_error);
+
+    auto appended = mapped_records<tick>(path, record_file_mode::append);
+    appended.append(tick{1001, 0.0, {}, 0, 'x'});
+    EXPECT_EQ(mapped_records<tick>(path).size(), 1001);
+
+    auto moved = std::move(appended);
+    EXPECT_FALSE(appended.is_open());
+    EXPECT_EQ(moved.records().back().side, 'x');
+
+    auto recreated = mapped_records<tick>(path, record_file_mode::create);
+    EXPECT_TRUE(recreated.empty());
+}
+
+TEST_F(mapped_records_test, partial_record)
+{
+    mapped_records<tick>(path, record_file_mode::create).append(tick{1, 1.0, {}, 1, 'b'});
+    {
+        auto out = std::ofstream(path, std::ios::binary | std::ios::app);
+        out.write("partial", 7);
+    }
+    EXPECT_EQ(mapped_records<tick>(path).size(), 1);
+
+    auto file = mapped_records<tick>(path, record_file_mode::append);
+    file.append(tick{2, 2.0, {}, 2, 's'});
+    EXPECT_EQ(file.size(), 2);
+    EXPECT_EQ(file[1].timestamp, 2);
+}
+
+TEST_F(mapped_records_test, validation)
+{
+    EXPECT_THROW(mapped_records<tick>{path}, std::system_error);
+
+    mapped_records<tick>(path, record_file_mode::create).append(tick{});
+    try
+    {
+        auto file = mapped_records<other_tick>(path);
+        FAIL();
+    }
+    catch (const std::runtime_error& e)
+    {
+        EXPECT_NE(std::string(e.what()).find("schema mismatch"), std::string::npos);
+    }
+
+    {
+        auto out = std::fstream(path, std::ios::binary | std::ios::in | std::ios::out);
+        out.write("NOTAFILE", 8);
+    }
+    EXPECT_THROW(mapped_records<tick>{path}, std::runtime_error);
+
+    std::filesystem::resize_file(path, 4);
+    EXPECT_THROW(mapped_records<tick>{path}, std::runtime_error);
+    EXPECT_THROW(read_records<tick>(path), std::runtime_error);
+
+    std::filesystem::resize_file(path, 0);
+    EXPECT_THROW(mapped_records<tick>{path}, std::runtime_error);
+    EXPECT_THROW(read_records<tick>(path), std::runtime_error);
+    EXPECT_EQ(mapped_records<tick>(path, record_file_mode::append).size(), 0);
+
+    // a file of the previous version
+    mapped_records<tick>(path, record_file_mode::create).append(tick{});
+    {
+        auto out = std::fstream(path, std::ios::binary | std::ios::in | std::ios::out);
+        const auto version = std::uint32_t{1};
+        out.seekp(8);
+        out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    EXPECT_THROW(mapped_records<tick>{path}, std::runtime_error);
+}
+
+TEST_F(mapped_records_test, read_records)
+{
+    EXPECT_THROW(read_records<tick>(path), std::system_error);
+    {
+        auto file = mapped_records<tick>(path, record_file_mode::create);
+        file.append(tick{1, 100.5, {}, -10, 'b'});
+        file.append(tick{2, 101.5, {}, 20, 's'});
+    }
+
+    const auto same = read_records<tick>(path);
+    ASSERT_EQ(same.size(), 2);
+    EXPECT_EQ(same[1].side, 's');
+
+    const auto converted = read_records<new_tick>(path);
+    ASSERT_EQ(converted.size(), 2);
+    EXPECT_EQ(converted[0].timestamp, 1);
+    EXPECT_EQ(converted[0].price, 100.5);
+    EXPECT_EQ(converted[0].volume, -10);
+    EXPECT_EQ(converted[0].weight, 1.0f);
+    EXPECT_EQ(converted[1].volume, 20);
+}
+// NOLINTEND
@@ -0,0 +1,50 @@
+#define FIELD_RFL_MAX_FIELDS 160
+#include <gtest/gtest.h>
+#include <string>
+#include "field_reflection.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+// struct with more fields than the default limit
+struct wide_struct
+{
+    int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22,
+        f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+        f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63, f64,
+        f65, f66, f67, f68, f69, f70, f71, f72, f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85,
+        f86, f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98, f99, f100, f101, f102, f103, f104, f105,
+        f106, f107, f108, f109, f110, f111, f112, f113, f114, f115, f116, f117, f118, f119, f120, f121, f122, f123,
+        f124, f125, f126, f127, f128, f129, f130, f131, f132, f133, f134, f135, f136, f137, f138, f139, f140, f141,
+        f142, f143, f144, f145, f146, f147, f148, f149;
+    std::string last;
+};
+
+TEST(field_reflection_max_fields, field_count)
+{
+    static_assert(field_countable<wide_struct>);
+    static_assert(field_count<wide_struct> == 151);
+}
+
+TEST(field_reflection_max_fields, field_name)
+{
+    static_assert(field_name<wide_struct, 0> == "f0");
+    static_assert(field_name<wide_struct, 149> == "f149");
+    static_assert(field_name<wide_struct, 150> == "last");
+}
+
+TEST(field_reflection_max_fields, get_field)
+{
+    auto s = wide_struct{};
+    s.f100 = 100;
+    s.last = "last";
+    EXPECT_EQ(&get_field<0>(s), &s.f0);
+    EXPECT_EQ(get_field<100>(s), 100);
+    EXPECT_EQ(get_field<150>(s), "last");
+    static_assert(std::is_same_v<field_type<wide_struct, 150>, std::string>);
+
+    auto t = to_tuple(std::move(s));
+    EXPECT_EQ(std::get<100>(t), 100);
+    EXPECT_EQ(std::get<150>(t), "last");
+}
+// NOLINTEND
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "field_reflection/schema.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+namespace v1
+{
+    struct point
+    {
+        float x;
+        float y;
+    };
+
+    struct tick
+    {
+        std::uint64_t timestamp;
+        std::int32_t volume;
+        double price;
+        char side;
+        point position;
+    };
+}  // namespace v1
+
+namespace v2
+{
+    // reordered, widened, added and dropped fields
+    struct tick
+    {
+        std::uint64_t timestamp;
+        double price;
+        std::int64_t volume;
+        float weight = 1.0f;
+        char side;
+    };
+
+    // prefix of the old layout
+    struct prefix
+    {
+        std::uint64_t timestamp;
+        std::int32_t volume;
+        double price;
+    };
+
+    // floating-point to a narrower integer
+    struct rounded
+    {
+        std::uint64_t timestamp;
+        std::int16_t price;
+    };
+
+    struct incompatible
+    {
+        std::uint64_t timestamp;
+        double position;
+    };
+}  // namespace v2
+
+static std::vector<std::byte> to_bytes(const std::vector<v1::tick>& ticks)
+{
+    auto bytes = std::vector<std::byte>(ticks.size() * sizeof(v1::tick));
+    std::memcpy(bytes.data(), ticks.data(), bytes.size());
+    return bytes;
+}
+
+TEST(record_converter, identity)
+{
+    const auto converter = record_converter<v1::tick>(make_record_schema<v1::tick>());
+    EXPECT_TRUE(converter.is_identity());
+    ASSERT_EQ(converter.plan().size(), 1);
+    EXPECT_EQ(converter.plan()[0].kind, conversion_kind::copy);
+
+    const auto ticks = std::vector<v1::tick>{{1, 10, 100.5, 'b', {1.0f, 2.0f}}, {2, 20, 101.5, 's', {3.0f, 4.0f}}};
+    const auto result = converter.convert_all(to_bytes(ticks));
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[1].volume, 20);
+    EXPECT_EQ(result[1].position.y, 4.0f);
+}
+
+TEST(record_converter, evolution)
+{
+    const auto converter = record_converter<v2::tick>(make_record_schema<v1::tick>());
+    EXPECT_FALSE(converter.is_identity());
+    EXPECT_EQ(converter.source_size(), sizeof(v1::tick));
+
+    const auto& plan = converter.plan();
+    ASSERT_EQ(plan.size(), 5);
+    EXPECT_EQ(plan[0].kind, conversion_kind::copy);
+    EXPECT_EQ(plan[1].kind, conversion_kind::copy);
+    EXPECT_EQ(plan[1].source_offset, offsetof(v1::tick, price));
+    EXPECT_EQ(plan[1].target_offset, offsetof(v2::tick, price));
+    EXPECT_EQ(plan[2].kind, conversion_kind::convert);
+    EXPECT_EQ(plan[3].kind, conversion_kind::default_value);
+    EXPECT_EQ(plan[4].kind, conversion_kind::copy);
+
+    const auto ticks = std::vector<v1::tick>{{1, -10, 100.5, 'b', {}}, {2, 20, 101.5, 's', {}}};
+    const auto bytes = to_bytes(ticks);
+    auto result = std::vector<v2::tick>(2);
+    converter.convert(bytes, std::span(result));
+    EXPECT_EQ(result[0].timestamp, 1);
+    EXPECT_EQ(result[0].price, 100.5);
+    EXPECT_EQ(result[0].volume, -10);
+    EXPECT_EQ(result[0].weight, 1.0f);
+    EXPECT_EQ(result[0].side, 'b');
+    EXPECT_EQ(result[1].volume, 20);
+    EXPECT_EQ(result[1].side, 's');
+
+    const auto single = converter.convert(std::span(bytes).subspan(sizeof(v1::tick)));
+    EXPECT_EQ(single.timestamp, 2);
+    EXPECT_THROW((void)converter.convert(std::span(bytes).first(8)), std::out_of_range);
+    EXPECT_THROW(converter.convert(bytes, std::span(result).first(1)), std::length_error);
+}
+
+TEST(record_converter, copy_runs)
+{
+    // the fields and the padding between them are copied at once
+    const auto converter = record_converter<v2::prefix>(make_record_schema<v1::tick>());
+    ASSERT_EQ(converter.plan().size(), 1);
+    EXPECT_EQ(converter.plan()[0].size, offsetof(v2::prefix, price) + sizeof(double));
+    EXPECT_FALSE(converter.is_identity());
+
+    const auto result = converter.convert_all(to_bytes({{1, 10, 100.5, 'b', {}}}));
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result[0].volume, 10);
+    EXPECT_EQ(result[0].price, 100.5);
+}
+
+TEST(record_converter, clamp)
+{
+    const auto converter = record_converter<v2::rounded>(make_record_schema<v1::tick>());
+    ASSERT_EQ(converter.plan().size(), 2);
+    EXPECT_EQ(converter.plan()[1].kind, conversion_kind::convert);
+
+    const auto result = converter.convert_all(to_bytes({{1, 0, -100.5, 'b', {}},
+                                                        {2, 0, 1e9, 'b', {}},
+                                                        {3, 0, -1e9, 'b', {}},
+                                                        {4, 0, std::numeric_limits<double>::quiet_NaN(), 'b', {}},
+                                                        {5, 0, std::numeric_limits<double>::infinity(), 'b', {}}}));
+    ASSERT_EQ(result.size(), 5);
+    EXPECT_EQ(result[0].price, -100);
+    EXPECT_EQ(result[1].price, std::numeric_limits<std::int16_t>::max());
+    EXPECT_EQ(result[2].price, std::numeric_limits<std::int16_t>::lowest());
+    EXPECT_EQ(result[3].price, 0);
+    EXPECT_EQ(result[4].price, std::numeric_limits<std::int16_t>::max());
+}
+
+TEST(record_converter, invalid)
+{
+    EXPECT_THROW(record_converter<v2::incompatible>(make_record_schema<v1::tick>()), std::runtime_error);
+
+    auto schema = make_record_schema<v1::tick>();
+    schema.fields[2].offset = schema.size;
+    EXPECT_THROW(record_converter<v1::tick>{schema}, std::runtime_error);
+
+    // a nested type of another layout is not copied
+    schema = make_record_schema<v1::tick>();
+    schema.fields[4].hash ^= 1;
+    EXPECT_THROW(record_converter<v1::tick>{schema}, std::runtime_error);
+}
+// NOLINTEND
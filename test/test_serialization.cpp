@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "field_reflection/serialization.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+struct header
+{
+    std::uint32_t id;
+    std::uint16_t kind;
+    std::uint16_t flags;
+    std::array<std::uint8_t, 8> tag;
+};
+
+struct point
+{
+    double x;
+    double y;
+};
+
+struct message
+{
+    header h;
+    std::uint8_t priority;
+    std::uint64_t timestamp;
+    std::string text;
+    std::vector<point> points;
+    std::map<std::string, std::vector<int>> attributes;
+    std::optional<std::string> comment;
+    std::tuple<int, std::string> pair;
+    std::set<int> ids;
+    std::list<std::string> lines;
+    std::vector<bool> bits;
+};
+
+TEST(serialization, trivially_copyable)
+{
+    auto h = header{1, 2, 3, {4, 5, 6, 7, 8, 9, 10, 11}};
+    auto bytes = serialize(h);
+    EXPECT_EQ(bytes.size(), sizeof(header));
+    EXPECT_EQ(serialized_size(h), sizeof(header));
+
+    auto result = deserialize<header>(bytes);
+    EXPECT_EQ(result.id, 1);
+    EXPECT_EQ(result.kind, 2);
+    EXPECT_EQ(result.flags, 3);
+    EXPECT_EQ(result.tag, h.tag);
+
+    // padding is not written
+    struct padded
+    {
+        std::uint8_t a;
+        std::uint32_t b;
+        std::uint16_t c;
+        std::uint16_t d;
+    };
+    auto p = padded{1, 2, 3, 4};
+    EXPECT_EQ(serialized_size(p), 9);
+    auto q = deserialize<padded>(serialize(p));
+    EXPECT_EQ(q.a, 1);
+    EXPECT_EQ(q.b, 2);
+    EXPECT_EQ(q.c, 3);
+    EXPECT_EQ(q.d, 4);
+
+    // the derived layout of an over-aligned member is not verified, so the fields are written one by one
+    struct over_aligned
+    {
+        char a;
+        alignas(2) char b;
+        char c;
+        int x;
+    };
+    static_assert(!field_layoutable<over_aligned>);
+    EXPECT_EQ(serialized_size(over_aligned{1, 2, 3, 4}), 3 + sizeof(int));
+    auto o = deserialize<over_aligned>(serialize(over_aligned{1, 2, 3, 4}));
+    EXPECT_EQ(o.a, 1);
+    EXPECT_EQ(o.b, 2);
+    EXPECT_EQ(o.c, 3);
+    EXPECT_EQ(o.x, 4);
+}
+
+struct mixed
+{
+    std::int32_t a;
+    std::int32_t b;
+    std::int64_t c;
+    std::string s;
+};
+
+// the same with an over-aligned member, whose layout is refuted at run time
+struct mixed_over_aligned
+{
+    char a;
+    alignas(2) char b;
+    char c;
+    std::int32_t x;
+    std::string s;
+};
+
+TEST(serialization, mixed)
+{
+    // the trivially copyable prefix is one segment even though the struct has a string
+    static_assert(detail::serialization_segments<mixed>.second == 2);
+    EXPECT_EQ(serialized_size(mixed{1, 2, 3, "abc"}), 16 + sizeof(std::uint64_t) + 3);
+    auto m = deserialize<mixed>(serialize(mixed{1, 2, 3, "abc"}));
+    EXPECT_EQ(m.a, 1);
+    EXPECT_EQ(m.b, 2);
+    EXPECT_EQ(m.c, 3);
+    EXPECT_EQ(m.s, "abc");
+
+    ASSERT_FALSE(layout_verified<mixed_over_aligned>());
+    auto o = deserialize<mixed_over_aligned>(serialize(mixed_over_aligned{1, 2, 3, 4, "x"}));
+    EXPECT_EQ(o.a, 1);
+    EXPECT_EQ(o.b, 2);
+    EXPECT_EQ(o.c, 3);
+    EXPECT_EQ(o.x, 4);
+    EXPECT_EQ(o.s, "x");
+}
+
+TEST(serialization, nested)
+{
+    auto m = message{
+        .h = {7, 8, 9, {}},
+        .priority = 3,
+        .timestamp = 123456789,
+        .text = "hello",
+        .points = {{1.0, 2.0}, {3.0, 4.0}},
+        .attributes = {{"a", {1, 2}}, {"b", {}}},
+        .comment = "note",
+        .pair = {42, "answer"},
+        .ids = {3, 1, 2},
+        .lines = {"x", "yy"},
+        .bits = {true, false, true},
+    };
+
+    auto bytes = std::vector<char>{'#'};
+    const auto size = serialize(m, bytes);
+    EXPECT_EQ(size, serialized_size(m));
+    EXPECT_EQ(bytes.size(), size + 1);
+    EXPECT_EQ(bytes[0], '#');
+
+    auto result = deserialize<message>(std::as_bytes(std::span(bytes)).subspan(1));
+    EXPECT_EQ(result.h.id, 7);
+    EXPECT_EQ(result.priority, 3);
+    EXPECT_EQ(result.timestamp, 123456789);
+    EXPECT_EQ(result.text, "hello");
+    ASSERT_EQ(result.points.size(), 2);
+    EXPECT_EQ(result.points[1].y, 4.0);
+    EXPECT_EQ(result.attributes, m.attributes);
+    EXPECT_EQ(result.comment, "note");
+    EXPECT_EQ(result.pair, m.pair);
+    EXPECT_EQ(result.ids, m.ids);
+    EXPECT_EQ(result.lines, m.lines);
+    EXPECT_EQ(result.bits, m.bits);
+
+    m.comment.reset();
+    auto into = message{};
+    into.comment = "stale";
+    const auto bytes2 = serialize(m);
+    EXPECT_EQ(deserialize(bytes2, into), bytes2.size());
+    EXPECT_FALSE(into.comment.has_value());
+}
+
+TEST(serialization, span)
+{
+    auto p = point{1.0, 2.0};
+    auto buffer = std::array<std::byte, 32>{};
+    EXPECT_EQ(serialize(p, std::span(buffer)), sizeof(point));
+    EXPECT_EQ(deserialize<point>(buffer).y, 2.0);
+
+    auto small = std::array<std::byte, 8>{};
+    EXPECT_THROW(serialize(p, std::span(small)), std::length_error);
+}
+
+TEST(serialization, truncated)
+{
+    auto m = message{};
+    m.text = "truncated";
+    m.points.resize(10);
+    const auto bytes = serialize(m);
+    for (auto size : {std::size_t{0}, sizeof(header), bytes.size() / 2, bytes.size() - 1})
+    {
+        EXPECT_THROW(deserialize<message>(std::span(bytes).first(size)), std::out_of_range);
+    }
+
+    // a huge element count must not allocate
+    auto v = std::vector<std::byte>(sizeof(std::uint64_t), std::byte{0xff});
+    struct numbers
+    {
+        std::vector<int> values;
+    };
+    EXPECT_THROW(deserialize<numbers>(v), std::out_of_range);
+}
+
+struct replica_state
+{
+    std::uint64_t version;
+    header h;
+    std::string owner;
+    std::vector<int> values;
+    point position;
+    double load;
+    std::array<std::uint32_t, 38> counters;
+};
+
+TEST(serialization, delta)
+{
+    auto old_state = replica_state{1, {1, 2, 3, {}}, "primary", {1, 2, 3}, {0.0, 0.0}, 0.5, {}};
+    auto new_state = old_state;
+
+    // the mask only
+    auto delta = make_delta(old_state, new_state);
+    EXPECT_EQ(delta.size(), 1);
+    EXPECT_EQ(delta[0], std::byte{0});
+
+    new_state.version = 2;
+    new_state.h.flags = 4;
+    new_state.position.y = 1.0;
+    delta = make_delta(old_state, new_state);
+    // mask, version, nested mask and flags of h, nested mask and y of position
+    EXPECT_EQ(delta.size(), 1 + sizeof(std::uint64_t) + 1 + sizeof(std::uint16_t) + 1 + sizeof(double));
+
+    auto replica = old_state;
+    EXPECT_EQ(apply_delta(replica, delta), delta.size());
+    EXPECT_EQ(replica.version, 2);
+    EXPECT_EQ(replica.h.flags, 4);
+    EXPECT_EQ(replica.h.kind, 2);
+    EXPECT_EQ(replica.position.y, 1.0);
+    EXPECT_EQ(serialize(replica), serialize(new_state));
+
+    new_state.owner = "secondary";
+    new_state.values.push_back(4);
+    new_state.counters[37] = 1;
+    auto buffer = std::vector<char>{};
+    EXPECT_TRUE(make_delta(old_state, new_state, buffer));
+    replica = old_state;
+    apply_delta(replica, std::as_bytes(std::span(buffer)));
+    EXPECT_EQ(serialize(replica), serialize(new_state));
+
+    EXPECT_THROW(apply_delta(replica, std::as_bytes(std::span(buffer)).first(buffer.size() - 1)),
+                 std::out_of_range);
+}
+// NOLINTEND
@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "field_reflection/soa_vector.hpp"
+
+// NOLINTBEGIN
+using namespace field_reflection;
+
+struct particle
+{
+    double x;
+    double y;
+    std::string name;
+    int id;
+};
+
+struct movable_particle
+{
+    std::unique_ptr<int> value;
+    int id;
+};
+
+// counts the live objects, and throws from the construction after `throw_after` more constructions
+struct counted
+{
+    static inline int live = 0;
+    static inline int throw_after = -1;
+
+    counted() { construct(); }
+    counted(const counted&) { construct(); }
+    counted& operator=(const counted&) = default;
+    ~counted() { --live; }
+
+    static void construct()
+    {
+        if (throw_after >= 0 && throw_after-- == 0) throw std::runtime_error("counted");
+        ++live;
+    }
+};
+
+struct counted_row
+{
+    std::string name;
+    counted value;
+};
+
+// counts the copies, which the algorithms on the iterators should not make
+struct copy_counted
+{
+    static inline int copies = 0;
+    int value;
+
+    copy_counted(int v) : value(v) {}
+    copy_counted(const copy_counted& other) : value(other.value) { ++copies; }
+    copy_counted(copy_counted&&) noexcept = default;
+    copy_counted& operator=(const copy_counted& other)
+    {
+        ++copies;
+        value = other.value;
+        return *this;
+    }
+    copy_counted& operator=(copy_counted&&) noexcept = default;
+    ~copy_counted() = default;
+};
+
+struct counted_particle
+{
+    copy_counted value;
+    int id;
+};
+
+static_assert(std::ranges::random_access_range<soa_vector<particle>>);
+static_assert(std::ranges::random_access_range<const soa_vector<particle>>);
+static_assert(std::permutable<soa_vector<particle>::iterator>);
+static_assert(std::is_same_v<std::iter_rvalue_reference_t<soa_vector<particle>::iterator>, particle>);
+
+TEST(soa_vector, push_back)
+{
+    auto v = soa_vector<particle>{};
+    EXPECT_TRUE(v.empty());
+    auto p = particle{1.0, 2.0, "first", 1};
+    v.push_back(p);
+    v.push_back(particle{3.0, 4.0, "second", 2});
+    auto r = v.emplace_back(5.0, 6.0, "third", 3);
+    EXPECT_EQ(get_field<2>(r), "third");
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_GE(v.capacity(), 3);
+
+    for (std::size_t i = 0; i < 100; ++i) v.push_back(particle{0.0, 0.0, std::string(32, 'a'), int(i)});
+    EXPECT_EQ(v.size(), 103);
+    EXPECT_EQ(get_field<2>(v[0]), "first");
+    EXPECT_EQ(get_field<2>(v[1]), "second");
+    EXPECT_EQ(get_field<3>(v.back()), 99);
+
+    v.pop_back();
+    EXPECT_EQ(v.size(), 102);
+    EXPECT_EQ(get_field<3>(v.back()), 98);
+    EXPECT_THROW(v.at(102), std::out_of_range);
+
+    auto mv = soa_vector<movable_particle>{};
+    mv.push_back(movable_particle{std::make_unique<int>(1), 1});
+    mv.emplace_back(std::make_unique<int>(2), 2);
+    mv.reserve(100);
+    EXPECT_EQ(*get_field<0>(mv[0]), 1);
+    EXPECT_EQ(*get_field<0>(mv[1]), 2);
+}
+
+TEST(soa_vector, reference)
+{
+    auto v = soa_vector<particle>{{1.0, 2.0, "a", 1}, {3.0, 4.0, "b", 2}};
+    particle p = v[1];
+    EXPECT_EQ(p.x, 3.0);
+    EXPECT_EQ(p.name, "b");
+
+    v[0] = particle{5.0, 6.0, "c", 3};
+    EXPECT_EQ(get_field<0>(v[0]), 5.0);
+    EXPECT_EQ(get_field<2>(v[0]), "c");
+    v[1] = v[0];
+    EXPECT_EQ(get_field<2>(v[1]), "c");
+    get_field<3>(v[1]) = 4;
+
+    auto names = std::vector<std::string_view>{};
+    for_each_field(v[1], [&](std::string_view name, auto& field) {
+        names.push_back(name);
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(field)>, double>) field *= 2;
+    });
+    EXPECT_EQ(names, (std::vector<std::string_view>{"x", "y", "name", "id"}));
+    EXPECT_EQ(get_field<0>(v[1]), 10.0);
+    EXPECT_EQ(get_field<3>(v[1]), 4);
+
+    const auto& cv = v;
+    static_assert(std::is_same_v<decltype(get_field<0>(cv[0])), const double&>);
+    auto count = 0;
+    for_each_field(cv[0], [&](const auto&) { ++count; });
+    EXPECT_EQ(count, 4);
+}
+
+TEST(soa_vector, iterator)
+{
+    auto v = soa_vector<particle>{};
+    for (int i = 0; i < 10; ++i) v.push_back(particle{double(i), 0.0, std::to_string(i), 10 - i});
+
+    std::ranges::sort(v, {}, [](const auto& r) { return get_field<3>(r); });
+    auto i = 1;
+    for (auto r : v) EXPECT_EQ(get_field<3>(r), i++);
+    EXPECT_EQ(get_field<2>(v.front()), "9");
+
+    soa_vector<particle>::const_iterator it = v.begin();
+    EXPECT_EQ(v.end() - it, 10);
+    EXPECT_EQ(get_field<3>(it[2]), 3);
+
+    // iter_move moves the fields out of the row, with which the algorithms rotate the rows without copying them
+    auto cv = soa_vector<counted_particle>{};
+    for (int n = 0; n < 3; ++n) cv.emplace_back(n, n);
+    copy_counted::copies = 0;
+    auto first = counted_particle(std::ranges::iter_move(cv.begin()));
+    *cv.begin() = std::ranges::iter_move(cv.begin() + 1);
+    *(cv.begin() + 1) = std::ranges::iter_move(cv.begin() + 2);
+    *(cv.begin() + 2) = std::move(first);
+    std::ranges::iter_swap(cv.begin(), cv.begin() + 1);
+    EXPECT_EQ(copy_counted::copies, 0);
+    EXPECT_EQ(get_field<0>(cv[0]).value, 2);
+    EXPECT_EQ(get_field<0>(cv[1]).value, 1);
+    EXPECT_EQ(get_field<0>(cv[2]).value, 0);
+
+    auto strings = soa_vector<particle>{{0.0, 0.0, std::string(32, 'a'), 0}};
+    auto moved = particle(std::ranges::iter_move(strings.begin()));
+    EXPECT_EQ(moved.name, std::string(32, 'a'));
+    EXPECT_TRUE(get_field<2>(strings[0]).empty());
+
+    get_field<2>(strings[0]) = "b";
+    auto copied = particle(std::ranges::iter_move(std::as_const(strings).begin()));
+    EXPECT_EQ(copied.name, "b");
+    EXPECT_EQ(get_field<2>(strings[0]), "b");
+}
+
+TEST(soa_vector, column)
+{
+    auto v = soa_vector<particle>{};
+    for (int i = 0; i < 10; ++i) v.push_back(particle{double(i), double(i * 2), "", i});
+
+    auto xs = v.column<0>();
+    static_assert(std::is_same_v<decltype(xs), std::span<double>>);
+    EXPECT_EQ(xs.size(), 10);
+    auto sum = 0.0;
+    for (auto x : xs) sum += x;
+    EXPECT_EQ(sum, 45.0);
+
+    const auto& cv = v;
+    static_assert(std::is_same_v<decltype(cv.column<3>()), std::span<const int>>);
+    EXPECT_EQ(cv.column<1>()[4], 8.0);
+    EXPECT_EQ(cv.column<1>().data() + 1, &get_field<1>(cv[1]));
+}
+
+TEST(soa_vector, resize)
+{
+    auto v = soa_vector<particle>(3);
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(get_field<0>(v[2]), 0.0);
+    EXPECT_EQ(get_field<2>(v[2]), "");
+
+    v.resize(5, particle{1.0, 1.0, "x", 1});
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(get_field<2>(v[4]), "x");
+    EXPECT_EQ(get_field<2>(v[2]), "");
+
+    v.resize(1);
+    EXPECT_EQ(v.size(), 1);
+    v.reserve(64);
+    EXPECT_EQ(v.capacity(), 64);
+    EXPECT_EQ(v.column<2>().size(), 1);
+
+    auto copy = v;
+    EXPECT_EQ(copy.size(), 1);
+    get_field<2>(copy[0]) = "copy";
+    EXPECT_EQ(get_field<2>(v[0]), "");
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(get_field<2>(moved[0]), "copy");
+    EXPECT_TRUE(copy.empty());
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.capacity(), 64);
+}
+
+TEST(soa_vector, constructor_exception)
+{
+    {
+        auto row = counted_row{std::string(32, 'a'), {}};
+        auto v = soa_vector<counted_row>(3, row);
+        EXPECT_EQ(counted::live, 4);
+
+        counted::throw_after = 2;
+        EXPECT_THROW(auto copy = v, std::runtime_error);
+        EXPECT_EQ(counted::live, 4);
+
+        counted::throw_after = 2;
+        EXPECT_THROW(soa_vector<counted_row>(3), std::runtime_error);
+        EXPECT_EQ(counted::live, 4);
+
+        counted::throw_after = 1;
+        EXPECT_THROW(soa_vector<counted_row>(3, row), std::runtime_error);
+        EXPECT_EQ(counted::live, 4);
+
+        counted::throw_after = 5;  // three copies into the initializer list
+        EXPECT_THROW((soa_vector<counted_row>{row, row, row}), std::runtime_error);
+        EXPECT_EQ(counted::live, 4);
+        counted::throw_after = -1;
+    }
+    EXPECT_EQ(counted::live, 0);
+}
+
+TEST(soa_vector, reserve_exception)
+{
+    {
+        // the names are moved without throwing, and the counted values are copied since their move may throw
+        auto v = soa_vector<counted_row>(3, counted_row{std::string(32, 'a'), {}});
+        get_field<0>(v[2]) = std::string(32, 'b');
+        EXPECT_EQ(v.capacity(), 3);
+
+        counted::throw_after = 1;
+        EXPECT_THROW(v.reserve(16), std::runtime_error);
+        counted::throw_after = -1;
+        EXPECT_EQ(v.size(), 3);
+        EXPECT_EQ(v.capacity(), 3);
+        EXPECT_EQ(get_field<0>(v[0]), std::string(32, 'a'));
+        EXPECT_EQ(get_field<0>(v[2]), std::string(32, 'b'));
+        EXPECT_EQ(counted::live, 3);
+
+        v.reserve(16);
+        EXPECT_EQ(v.capacity(), 16);
+        EXPECT_EQ(get_field<0>(v[2]), std::string(32, 'b'));
+        EXPECT_EQ(counted::live, 3);
+    }
+    EXPECT_EQ(counted::live, 0);
+}
+// NOLINTEND